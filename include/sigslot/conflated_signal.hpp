@@ -0,0 +1,266 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <sigslot/signal.hpp>
+
+namespace sigslot {
+
+namespace detail {
+
+// a conflated signal, as seen by a conflation group
+struct conflated_base {
+    virtual ~conflated_base() = default;
+    virtual bool flush() = 0;
+};
+
+} // namespace detail
+
+/**
+ * A conflation group flushes many conflated signals in a single pass, typically
+ * once per frame of a UI or state synchronization loop.
+ *
+ * Signals are flushed in the order they became dirty. The group must outlive
+ * its signals, which must not be destroyed while the group is being flushed.
+ */
+class conflation_group {
+public:
+    conflation_group() = default;
+    conflation_group(const conflation_group &) = delete;
+    conflation_group & operator=(const conflation_group &) = delete;
+    ~conflation_group() = default;
+
+    /**
+     * Flush every dirty signal of the group
+     *
+     * Signals that become dirty during the flush, from a slot for instance,
+     * are left for the next one.
+     * Safety: thread safe
+     *
+     * @return the number of signals that were emitted
+     */
+    std::size_t flush() {
+        std::vector<detail::conflated_base *> batch;
+        {
+            std::lock_guard<std::mutex> _{m_mutex};
+            batch.swap(m_dirty);
+        }
+
+        std::size_t count = 0;
+        for (auto *c : batch) {
+            if (c && c->flush()) {
+                ++count;
+            }
+        }
+
+        // give the storage back to save an allocation on the next pass
+        std::lock_guard<std::mutex> _{m_mutex};
+        if (m_dirty.empty()) {
+            batch.clear();
+            m_dirty.swap(batch);
+        }
+        return count;
+    }
+
+    /**
+     * Number of signals waiting to be flushed
+     */
+    [[nodiscard]] std::size_t pending() const {
+        std::lock_guard<std::mutex> _{m_mutex};
+        return m_dirty.size();
+    }
+
+private:
+    template <GroupId, typename, typename...>
+    friend class conflated_signal_base;
+
+    void enqueue(detail::conflated_base *c) {
+        std::lock_guard<std::mutex> _{m_mutex};
+        m_dirty.push_back(c);
+    }
+
+    void remove(detail::conflated_base *c) {
+        std::lock_guard<std::mutex> _{m_mutex};
+        for (auto &d : m_dirty) {
+            if (d == c) {
+                d = nullptr;
+            }
+        }
+    }
+
+    mutable std::mutex m_mutex;
+    std::vector<detail::conflated_base *> m_dirty;
+};
+
+/**
+ * conflated_signal_base wraps a signal_base to coalesce emissions: emitting
+ * only stores the latest arguments and marks the signal dirty, while the
+ * slots are called once with the latest arguments on the next flush.
+ *
+ * Flushing happens on an explicit call to flush(), on a flush of the
+ * conflation group the signal belongs to, if any, or on the executor the
+ * signal was given, which receives a flush task each time the signal becomes
+ * dirty. The executor must run that task before the signal is destroyed.
+ *
+ * @tparam Group the group id type of the underlying signal
+ * @tparam Lockable a lock type to decide the lock policy
+ * @tparam T... the argument types of the emitting and slots functions
+ */
+template <GroupId Group, typename Lockable, typename... T>
+class conflated_signal_base final : public detail::conflated_base {
+    using lock_type = std::unique_lock<Lockable>;
+
+public:
+    using signal_type = signal_base<Group, Lockable, T...>;
+    using value_type = std::tuple<std::decay_t<T>...>;
+
+    conflated_signal_base() = default;
+
+    explicit conflated_signal_base(conflation_group &group)
+        : m_group{&group}
+    {}
+
+    template <trait::Executor Executor>
+    explicit conflated_signal_base(Executor &e)
+        : m_post{[&e](std::function<void()> f) { e.post(std::move(f)); }}
+    {}
+
+    conflated_signal_base(const conflated_signal_base &) = delete;
+    conflated_signal_base & operator=(const conflated_signal_base &) = delete;
+
+    ~conflated_signal_base() override {
+        if (m_group) {
+            m_group->remove(this);
+        }
+    }
+
+    /**
+     * Store the arguments, to be emitted on the next flush
+     *
+     * Effect: Overwrites the arguments of a previous emission not flushed
+     *         yet. The first emission after a flush notifies the conflation
+     *         group or posts a flush to the executor.
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * @param a... arguments to emit
+     */
+    template <typename... U>
+    void operator()(U && ...a) {
+        bool first = false;
+        {
+            lock_type lock(m_mutex);
+            if (m_value) {
+                // assign in place, to reuse the storage of the previous value
+                *m_value = std::forward_as_tuple(std::forward<U>(a)...);
+            } else {
+                m_value.emplace(std::forward<U>(a)...);
+            }
+            first = !std::exchange(m_dirty, true);
+        }
+
+        if (!first) {
+            m_coalesced.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        if (m_group) {
+            m_group->enqueue(this);
+        }
+        if (m_post) {
+            m_post([this] { flush(); });
+        }
+    }
+
+    /**
+     * Emit the latest arguments if the signal is dirty
+     *
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * @return true if the signal was emitted
+     */
+    bool flush() override {
+        std::optional<value_type> v;
+        {
+            lock_type lock(m_mutex);
+            if (!m_dirty) {
+                return false;
+            }
+            m_dirty = false;
+            v.swap(m_value);
+        }
+
+        std::apply([this](auto &...a) { m_sig(a...); }, *v);
+        return true;
+    }
+
+    [[nodiscard]] bool dirty() const {
+        lock_type lock(m_mutex);
+        return m_dirty;
+    }
+
+    /**
+     * Number of emissions that were superseded before being flushed
+     */
+    [[nodiscard]] std::size_t coalesced() const noexcept {
+        return m_coalesced.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * The underlying signal, to manage the connections
+     */
+    signal_type & signal() noexcept {
+        return m_sig;
+    }
+
+    template <typename... A>
+    requires requires(signal_type &s, A && ...a) { s.connect(std::forward<A>(a)...); }
+    connection connect(A && ...a) {
+        return m_sig.connect(std::forward<A>(a)...);
+    }
+
+    template <typename... A>
+    requires requires(signal_type &s, A && ...a) { s.connect_extended(std::forward<A>(a)...); }
+    connection connect_extended(A && ...a) {
+        return m_sig.connect_extended(std::forward<A>(a)...);
+    }
+
+    template <typename... A>
+    requires requires(signal_type &s, A && ...a) { s.disconnect(std::forward<A>(a)...); }
+    std::size_t disconnect(A && ...a) {
+        return m_sig.disconnect(std::forward<A>(a)...);
+    }
+
+    void disconnect_all() {
+        m_sig.disconnect_all();
+    }
+
+    [[nodiscard]] std::size_t slot_count() const noexcept {
+        return m_sig.slot_count();
+    }
+
+private:
+    signal_type m_sig;
+    mutable Lockable m_mutex;
+    std::optional<value_type> m_value;
+    bool m_dirty = false;
+    std::atomic<std::size_t> m_coalesced{0};
+    conflation_group *m_group = nullptr;
+    std::function<void(std::function<void()>)> m_post;
+};
+
+/**
+ * Specializations for thread-safe and single-threaded conflated signals
+ */
+template <typename... T>
+using conflated_signal_st = conflated_signal_base<int32_t, detail::null_mutex, T...>;
+
+template <typename... T>
+using conflated_signal = conflated_signal_base<int32_t, std::mutex, T...>;
+
+} // namespace sigslot
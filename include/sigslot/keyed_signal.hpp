@@ -0,0 +1,232 @@
+#pragma once
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <sigslot/signal.hpp>
+
+namespace sigslot {
+
+namespace trait {
+
+/// a key usable in a keyed signal
+template <typename K>
+concept HashableKey = std::equality_comparable<K> && requires(const K &k) {
+    { std::hash<K>{}(k) } -> std::convertible_to<std::size_t>;
+};
+
+} // namespace trait
+
+/**
+ * keyed_signal_base indexes its slots by key, so that an emission for a key
+ * only visits the slots connected to that key, instead of every slot
+ * filtering the keys it is interested in.
+ *
+ * Each key owns a signal of its own, with its own lock and snapshot of slots,
+ * so that emissions for different keys do not contend on the slots. The keys
+ * are spread over shards, each guarded by a lock held only for the time of a
+ * lookup.
+ *
+ * A key stays indexed once its last slot gets disconnected, until it is
+ * dropped with disconnect(key) or disconnect_all().
+ *
+ * @tparam Key the key type, hashable and equality comparable
+ * @tparam Lockable a lock type to decide the lock policy
+ * @tparam T... the argument types of the emitting and slots functions
+ */
+template <trait::HashableKey Key, typename Lockable, typename... T>
+class keyed_signal_base {
+    using lock_type = std::unique_lock<Lockable>;
+
+public:
+    using key_type = Key;
+    using signal_type = signal_base<int32_t, Lockable, T...>;
+    static constexpr bool is_thread_safe = signal_type::is_thread_safe;
+
+    keyed_signal_base() = default;
+    keyed_signal_base(const keyed_signal_base &) = delete;
+    keyed_signal_base & operator=(const keyed_signal_base &) = delete;
+
+    ~keyed_signal_base() {
+        disconnect_all();
+    }
+
+    /**
+     * Connect a callable to the slots of a key
+     *
+     * Takes the same arguments as signal_base::connect() after the key.
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * @param key the key to connect to
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename... A>
+    requires requires(signal_type &s, A && ...a) { s.connect(std::forward<A>(a)...); }
+    connection connect(key_type const& key, A && ...a) {
+        auto &sh = shard_of(key);
+        lock_type lock(sh.mutex);
+        return find_or_insert(sh, key).connect(std::forward<A>(a)...);
+    }
+
+    /**
+     * Connect a callable taking a connection reference to the slots of a key
+     * Safety: Thread-safety depends on locking policy.
+     */
+    template <typename... A>
+    requires requires(signal_type &s, A && ...a) { s.connect_extended(std::forward<A>(a)...); }
+    connection connect_extended(key_type const& key, A && ...a) {
+        auto &sh = shard_of(key);
+        lock_type lock(sh.mutex);
+        return find_or_insert(sh, key).connect_extended(std::forward<A>(a)...);
+    }
+
+    /**
+     * Emit a signal to the slots of a key
+     *
+     * Effect: All non blocked and connected slot functions of the key will be
+     *         called with supplied arguments, in group order.
+     * Safety: With proper locking, emission can happen from multiple threads
+     *         simultaneously, and only the lookup of the key is serialized
+     *         with the emissions of the keys of the same shard.
+     *
+     * @param key the key to emit for
+     * @param a... arguments to emit
+     */
+    template <typename... U>
+    void emit(key_type const& key, U && ...a) {
+        if (auto sig = find(key)) {
+            (*sig)(std::forward<U>(a)...);
+        }
+    }
+
+    /**
+     * Disconnect the slots of a key and drop the key from the index
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * @return the number of disconnected slots
+     */
+    std::size_t disconnect(key_type const& key) {
+        std::shared_ptr<signal_type> sig;
+        {
+            auto &sh = shard_of(key);
+            lock_type lock(sh.mutex);
+            auto it = sh.signals.find(key);
+            if (it == sh.signals.end()) {
+                return 0;
+            }
+            sig = std::move(it->second);
+            sh.signals.erase(it);
+        }
+
+        const auto count = sig->slot_count();
+        sig->disconnect_all();
+        return count;
+    }
+
+    /**
+     * Disconnect slots of a key, as signal_base::disconnect() would
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * @return the number of disconnected slots
+     */
+    template <typename... A>
+    requires (sizeof...(A) > 0) &&
+             requires(signal_type &s, A && ...a) { s.disconnect(std::forward<A>(a)...); }
+    std::size_t disconnect(key_type const& key, A && ...a) {
+        if (auto sig = find(key)) {
+            return sig->disconnect(std::forward<A>(a)...);
+        }
+        return 0;
+    }
+
+    /**
+     * Disconnect all the slots and drop every key
+     * Safety: Thread-safety depends on locking policy.
+     */
+    void disconnect_all() {
+        for (auto &sh : m_shards) {
+            map_type signals;
+            {
+                lock_type lock(sh.mutex);
+                signals.swap(sh.signals);
+            }
+            for (auto &[key, sig] : signals) {
+                sig->disconnect_all();
+            }
+        }
+    }
+
+    /**
+     * Number of slots connected to a key
+     * Safety: Thread-safety depends on locking policy.
+     */
+    [[nodiscard]] std::size_t slot_count(key_type const& key) const {
+        auto sig = find(key);
+        return sig ? sig->slot_count() : 0;
+    }
+
+    /**
+     * Number of indexed keys
+     * Safety: Thread-safety depends on locking policy.
+     */
+    [[nodiscard]] std::size_t key_count() const {
+        std::size_t count = 0;
+        for (auto &sh : m_shards) {
+            lock_type lock(sh.mutex);
+            count += sh.signals.size();
+        }
+        return count;
+    }
+
+private:
+    using map_type = std::unordered_map<key_type, std::shared_ptr<signal_type>>;
+
+    // a single shard suffices without concurrency
+    static constexpr std::size_t shard_count = is_thread_safe ? 16 : 1;
+
+    struct shard {
+        mutable Lockable mutex;
+        map_type signals;
+    };
+
+    shard & shard_of(key_type const& key) const {
+        // fibonacci hashing, so that the shard does not follow the low bits
+        // of the hash, which the buckets of the maps depend on
+        const std::uint64_t h = std::hash<key_type>{}(key);
+        return m_shards[((h * 0x9E3779B97F4A7C15ULL) >> 60) & (shard_count - 1)];
+    }
+
+    signal_type & find_or_insert(shard &sh, key_type const& key) {
+        auto &sig = sh.signals[key];
+        if (!sig) {
+            sig = std::make_shared<signal_type>();
+        }
+        return *sig;
+    }
+
+    // the signal of the key is kept alive for the time of an emission
+    std::shared_ptr<signal_type> find(key_type const& key) const {
+        auto &sh = shard_of(key);
+        lock_type lock(sh.mutex);
+        auto it = sh.signals.find(key);
+        return it == sh.signals.end() ? nullptr : it->second;
+    }
+
+    mutable std::array<shard, shard_count> m_shards;
+};
+
+/**
+ * Specializations for thread-safe and single-threaded keyed signals
+ */
+template <typename Key, typename... T>
+using keyed_signal_st = keyed_signal_base<Key, detail::null_mutex, T...>;
+
+template <typename Key, typename... T>
+using keyed_signal = keyed_signal_base<Key, std::mutex, T...>;
+
+} // namespace sigslot
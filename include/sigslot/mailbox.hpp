@@ -0,0 +1,307 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace sigslot {
+
+/**
+ * What a mailbox does with a task posted while it is full
+ */
+enum class OverflowPolicy {
+    BLOCK,        // wait for the consumer to make room
+    DROP_OLDEST,  // discard the oldest pending task to make room
+    DROP_NEWEST,  // discard the posted task
+    GROW,         // store the task in an unbounded, locked, overflow queue
+};
+
+/**
+ * A mailbox is a bounded multi-producer single-consumer queue of tasks, meant
+ * to deliver queued slots to a consumer thread. It satisfies the executor
+ * concept, so it can be handed to signal_base::connect_queued().
+ *
+ * Producers enqueue tasks without locking into a fixed size ring buffer. The
+ * consumer thread runs them in batches by calling dispatch(). What happens when
+ * the ring is full depends on the overflow policy. Occupancy and drop counters
+ * are maintained to help sizing the mailbox.
+ *
+ * Tasks posted from a given thread are run in the order they were posted.
+ */
+class mailbox {
+    using task_type = std::function<void()>;
+
+    struct cell {
+        std::atomic<std::size_t> seq{0};
+        task_type task;
+    };
+
+    static constexpr std::size_t cache_line = 64;
+
+public:
+    /**
+     * @param capacity the ring buffer size, rounded up to a power of two
+     * @param policy the overflow policy
+     */
+    explicit mailbox(std::size_t capacity, OverflowPolicy policy = OverflowPolicy::BLOCK)
+        : m_policy{policy}
+    {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size *= 2;
+        }
+
+        m_mask = size - 1;
+        m_cells = std::make_unique<cell[]>(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            m_cells[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    mailbox(const mailbox &) = delete;
+    mailbox & operator=(const mailbox &) = delete;
+    mailbox(mailbox &&) = delete;
+    mailbox & operator=(mailbox &&) = delete;
+    ~mailbox() = default;
+
+    /**
+     * Enqueue a task
+     *
+     * Safety: thread safe, lock-free unless the ring buffer is full, in which
+     *         case the overflow policy applies.
+     *
+     * @param f the task
+     * @return false if the task was dropped
+     */
+    bool post(task_type f) {
+        if (!m_overflowing.load(std::memory_order_acquire) && try_push(f)) {
+            note_occupancy();
+            return true;
+        }
+
+        switch (m_policy) {
+        case OverflowPolicy::BLOCK:
+            push_blocking(f);
+            break;
+        case OverflowPolicy::DROP_OLDEST:
+            push_dropping_oldest(f);
+            break;
+        case OverflowPolicy::DROP_NEWEST:
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        case OverflowPolicy::GROW:
+            push_overflow(f);
+            break;
+        }
+
+        note_occupancy();
+        return true;
+    }
+
+    /**
+     * Run pending tasks
+     *
+     * Safety: must only be called from one thread at a time, the consumer.
+     *
+     * @param max_items the maximum number of tasks to run
+     * @return the number of tasks run
+     */
+    std::size_t dispatch(std::size_t max_items = std::numeric_limits<std::size_t>::max()) {
+        std::size_t count = 0;
+        task_type task;
+
+        while (count < max_items && (try_pop(task) || pop_overflow(task))) {
+            ++count;
+            task();
+            task = nullptr;
+        }
+
+        if (count > 0) {
+            // wake up producers waiting for room
+            m_tail.notify_all();
+        }
+
+        return count;
+    }
+
+    /**
+     * Number of pending tasks, an approximation if producers are active
+     */
+    [[nodiscard]] std::size_t size() const noexcept {
+        const auto head = m_head.load(std::memory_order_relaxed);
+        const auto tail = m_tail.load(std::memory_order_relaxed);
+        const auto ring = head > tail ? head - tail : 0;
+        return ring + m_overflow_size.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /**
+     * Size of the ring buffer
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return m_mask + 1;
+    }
+
+    /**
+     * Highest number of pending tasks observed so far
+     */
+    [[nodiscard]] std::size_t peak_size() const noexcept {
+        return m_peak.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Number of tasks dropped by the DROP_OLDEST and DROP_NEWEST policies
+     */
+    [[nodiscard]] std::size_t dropped() const noexcept {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Number of tasks stored in the overflow queue by the GROW policy
+     */
+    [[nodiscard]] std::size_t overflowed() const noexcept {
+        return m_overflowed.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] OverflowPolicy policy() const noexcept {
+        return m_policy;
+    }
+
+private:
+    // bounded queue algorithm by Dmitry Vyukov, each cell sequence number
+    // tells whether it is ready to be written or read for a given position
+    bool try_push(task_type &f) {
+        auto pos = m_head.load(std::memory_order_relaxed);
+        cell *c = nullptr;
+
+        while (true) {
+            c = &m_cells[pos & m_mask];
+            const auto seq = c->seq.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+            if (diff == 0) {
+                if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_head.load(std::memory_order_relaxed);
+            }
+        }
+
+        c->task = std::move(f);
+        c->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(task_type &task) {
+        auto pos = m_tail.load(std::memory_order_relaxed);
+        cell *c = nullptr;
+
+        while (true) {
+            c = &m_cells[pos & m_mask];
+            const auto seq = c->seq.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+
+            if (diff == 0) {
+                if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        task = std::move(c->task);
+        c->task = nullptr;
+        c->seq.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    void push_blocking(task_type &f) {
+        while (true) {
+            const auto tail = m_tail.load(std::memory_order_acquire);
+            if (try_push(f)) {
+                break;
+            }
+            m_tail.wait(tail, std::memory_order_acquire);
+        }
+    }
+
+    // the oldest task may be popped concurrently by the consumer, which is
+    // fine as the ring buffer algorithm supports multiple consumers
+    void push_dropping_oldest(task_type &f) {
+        task_type victim;
+
+        while (!try_push(f)) {
+            if (try_pop(victim)) {
+                victim = nullptr;
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // once tasks have overflowed, subsequent ones go to the overflow queue
+    // too until it has been drained, so as to keep the ordering
+    void push_overflow(task_type &f) {
+        std::lock_guard<std::mutex> _{m_overflow_mutex};
+        m_overflow.push_back(std::move(f));
+        m_overflow_size.fetch_add(1, std::memory_order_relaxed);
+        m_overflowed.fetch_add(1, std::memory_order_relaxed);
+        m_overflowing.store(true, std::memory_order_release);
+    }
+
+    bool pop_overflow(task_type &task) {
+        if (m_overflow_size.load(std::memory_order_relaxed) == 0) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> _{m_overflow_mutex};
+        if (m_overflow.empty()) {
+            return false;
+        }
+
+        task = std::move(m_overflow.front());
+        m_overflow.pop_front();
+        m_overflow_size.fetch_sub(1, std::memory_order_relaxed);
+        if (m_overflow.empty()) {
+            m_overflowing.store(false, std::memory_order_release);
+        }
+        return true;
+    }
+
+    void note_occupancy() noexcept {
+        const auto s = size();
+        auto peak = m_peak.load(std::memory_order_relaxed);
+        while (s > peak && !m_peak.compare_exchange_weak(peak, s, std::memory_order_relaxed)) {}
+    }
+
+private:
+    alignas(cache_line) std::atomic<std::size_t> m_head{0};
+    alignas(cache_line) std::atomic<std::size_t> m_tail{0};
+    alignas(cache_line) std::atomic<std::size_t> m_peak{0};
+    std::atomic<std::size_t> m_dropped{0};
+    std::atomic<std::size_t> m_overflowed{0};
+    std::atomic<std::size_t> m_overflow_size{0};
+    std::atomic<bool> m_overflowing{false};
+
+    std::unique_ptr<cell[]> m_cells;
+    std::size_t m_mask = 0;
+    OverflowPolicy m_policy;
+
+    std::mutex m_overflow_mutex;
+    std::deque<task_type> m_overflow;
+};
+
+} // namespace sigslot
@@ -0,0 +1,201 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace sigslot {
+
+/**
+ * A background reaper of expired slots.
+ *
+ * Slots tracking an object through a weak pointer, or as a trackable, are
+ * only found dead when called, at which point the emitting thread takes the
+ * lock of the signal and copies its slot list to remove them. Signals added
+ * to a reaper leave that work to it instead: their emissions skip the slots
+ * of dead objects, and a thread of the reaper sweeps them periodically with
+ * collect_expired(), in batches, so that emitters never wait long for the
+ * lock of a signal being swept.
+ *
+ * A signal must outlive its registration, which must not outlive the reaper.
+ */
+class reaper {
+public:
+    static constexpr std::chrono::milliseconds default_period{100};
+    static constexpr std::size_t default_batch = 256;
+
+    /**
+     * A registration keeps a signal swept by a reaper until destroyed
+     */
+    class registration {
+    public:
+        registration() = default;
+        registration(const registration &) = delete;
+        registration & operator=(const registration &) = delete;
+
+        registration(registration && o) noexcept
+            : m_reaper{std::exchange(o.m_reaper, nullptr)}
+            , m_id{o.m_id}
+        {}
+
+        registration & operator=(registration && o) noexcept {
+            if (this != &o) {
+                reset();
+                m_reaper = std::exchange(o.m_reaper, nullptr);
+                m_id = o.m_id;
+            }
+            return *this;
+        }
+
+        ~registration() {
+            reset();
+        }
+
+        /**
+         * Stop sweeping the signal, waiting for a sweep in progress
+         * Safety: thread safe
+         */
+        void reset() {
+            if (m_reaper) {
+                std::exchange(m_reaper, nullptr)->remove(m_id);
+            }
+        }
+
+        [[nodiscard]] bool active() const noexcept {
+            return m_reaper != nullptr;
+        }
+
+    private:
+        friend class reaper;
+        registration(reaper *r, std::uint64_t id) noexcept
+            : m_reaper{r}
+            , m_id{id}
+        {}
+
+        reaper *m_reaper = nullptr;
+        std::uint64_t m_id = 0;
+    };
+
+    /**
+     * @param period the time between two sweeps
+     * @param batch the maximum number of slots removed from a signal with
+     *        one acquisition of its lock
+     */
+    explicit reaper(std::chrono::milliseconds period = default_period,
+                    std::size_t batch = default_batch)
+        : m_period{period}
+        , m_batch{batch == 0 ? 1 : batch}
+        , m_thread{[this] { run(); }}
+    {}
+
+    reaper(const reaper &) = delete;
+    reaper & operator=(const reaper &) = delete;
+    reaper(reaper &&) = delete;
+    reaper & operator=(reaper &&) = delete;
+
+    ~reaper() {
+        {
+            std::lock_guard<std::mutex> _{m_mutex};
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+    }
+
+    /**
+     * Sweep a signal periodically, its emissions leaving expired slots to
+     * the reaper until the registration gets destroyed
+     *
+     * Safety: thread safe
+     *
+     * @param sig a signal, whose lock policy must allow sweeping from the
+     *        thread of the reaper
+     * @return a registration that keeps the signal swept
+     */
+    template <typename Sig>
+    [[nodiscard]] registration add(Sig &sig) {
+        std::lock_guard<std::mutex> _{m_mutex};
+        const auto id = ++m_last_id;
+        m_entries.push_back({id, &sig,
+            [](void *s, std::size_t max) { return static_cast<Sig *>(s)->collect_expired(max); },
+            [](void *s, bool defer) { static_cast<Sig *>(s)->defer_expired_cleanup(defer); }});
+        sig.defer_expired_cleanup(true);
+        return {this, id};
+    }
+
+    /**
+     * Sweep every registered signal right away
+     * Safety: thread safe
+     *
+     * @return the number of removed slots
+     */
+    std::size_t collect() {
+        std::lock_guard<std::mutex> _{m_mutex};
+        return sweep();
+    }
+
+    /**
+     * Number of slots removed by the reaper so far
+     * Safety: thread safe
+     */
+    [[nodiscard]] std::size_t collected() const {
+        std::lock_guard<std::mutex> _{m_mutex};
+        return m_collected;
+    }
+
+private:
+    struct entry {
+        std::uint64_t id;
+        void *sig;
+        std::size_t (*collect)(void *, std::size_t);
+        void (*defer)(void *, bool);
+    };
+
+    void remove(std::uint64_t id) {
+        std::lock_guard<std::mutex> _{m_mutex};
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->id == id) {
+                it->defer(it->sig, false);
+                m_entries.erase(it);
+                return;
+            }
+        }
+    }
+
+    // to be called under lock: sweep every signal, batch by batch
+    std::size_t sweep() {
+        std::size_t count = 0;
+        for (const auto &e : m_entries) {
+            std::size_t n = 0;
+            do {
+                n = e.collect(e.sig, m_batch);
+                count += n;
+            } while (n == m_batch);
+        }
+        m_collected += count;
+        return count;
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        while (!m_cv.wait_for(lock, m_period, [this] { return m_stop; })) {
+            sweep();
+        }
+    }
+
+    const std::chrono::milliseconds m_period;
+    const std::size_t m_batch;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::vector<entry> m_entries;
+    std::uint64_t m_last_id = 0;
+    std::size_t m_collected = 0;
+    bool m_stop = false;
+    std::thread m_thread;  // last, started once the members above are ready
+};
+
+} // namespace sigslot
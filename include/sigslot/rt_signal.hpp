@@ -0,0 +1,370 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <sigslot/signal.hpp>
+
+namespace sigslot {
+
+namespace detail {
+
+// the real-time emissions running on the current thread, innermost first,
+// linked through the stacks of the emitting functions
+struct rt_emission {
+    explicit rt_emission(const void *s) noexcept
+        : sig{s}
+        , prev{top}
+    {
+        top = this;
+    }
+
+    ~rt_emission() {
+        top = prev;
+    }
+
+    rt_emission(const rt_emission &) = delete;
+    rt_emission & operator=(const rt_emission &) = delete;
+
+    static bool running(const void *s) noexcept {
+        for (const auto *e = top; e; e = e->prev) {
+            if (e->sig == s) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const void *sig;
+    rt_emission *prev;
+    static inline thread_local rt_emission *top = nullptr;
+};
+
+} // namespace detail
+
+/**
+ * rt_signal_base is a signal whose emission is wait-free, for real-time
+ * threads such as audio or control loops: emitting neither allocates nor
+ * frees memory, and never takes a lock.
+ *
+ * - Slots are read from an immutable snapshot published through an atomic
+ *   pointer. An emission announces itself by incrementing one of two reader
+ *   counters, picked by a phase flipped by writers, then loads the snapshot.
+ * - Arguments are passed down to the slots by reference, as with signal_base.
+ * - Reclamation is deferred: a writer publishes a new snapshot, then waits
+ *   for the emissions that may still read the previous one, draining the
+ *   counter of each phase in turn, and only then destroys it, along with the
+ *   slots it was the last owner of. Writers allocate and lock Lockable.
+ * - Disconnecting, from a slot or elsewhere, only flags the slot, which
+ *   emissions skip until the next write, or cleanup(), drops it. Slots that
+ *   track an object through a weak pointer are dropped the same way.
+ *
+ * Slots own what they capture, and a slot locking a weak pointer may find
+ * itself the last owner of its object, which the emission then destroys.
+ *
+ * Writing from a slot of the signal does not wait for the emission of the
+ * calling thread: the previous snapshot is destroyed by a later write. Two
+ * threads writing to each other's signal from slots would wait for one
+ * another, which must be avoided. Trackable and observer objects are not
+ * supported, as their teardown may block.
+ *
+ * @tparam Lockable a lock type used by writers
+ * @tparam T... the argument types of the emitting and slots functions
+ */
+template <typename Lockable, typename... T>
+class rt_signal_base final : public detail::cleanable<int32_t> {
+    using lock_type = std::unique_lock<Lockable>;
+    using slot_base = detail::slot_base<int32_t, T...>;
+    using slot_ptr = detail::slot_ptr<int32_t, T...>;
+
+    struct snapshot {
+        std::vector<slot_ptr> slots;
+    };
+
+public:
+    using group_id = int32_t;
+
+    static constexpr std::size_t cache_line = 64;
+
+    rt_signal_base()
+        : m_snapshot{new snapshot}
+    {}
+
+    rt_signal_base(const rt_signal_base &) = delete;
+    rt_signal_base & operator=(const rt_signal_base &) = delete;
+    rt_signal_base(rt_signal_base &&) = delete;
+    rt_signal_base & operator=(rt_signal_base &&) = delete;
+
+    ~rt_signal_base() override {
+        // connections that outlive the signal must not reach it anymore
+        std::unique_ptr<snapshot> last{m_snapshot.exchange(nullptr)};
+        for (const auto &s : last->slots) {
+            s->disconnect();
+        }
+        m_graveyard.clear();
+    }
+
+    /**
+     * Emit a signal
+     *
+     * Effect: All non blocked and connected slot functions will be called
+     *         with supplied arguments.
+     * Safety: Wait-free, with neither allocation nor deallocation, save for
+     *         what the slots do themselves. Emission can happen from multiple
+     *         threads simultaneously.
+     *
+     * @param a... arguments to emit
+     */
+    template <typename... U>
+    void operator()(U && ...a) {
+        emit(std::forward<U>(a)...);
+    }
+
+    /**
+     * Connect a callable of compatible arguments
+     * Safety: thread safe, allocates and takes the lock
+     *
+     * @param c a callable
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Callable>
+    requires trait::Callable<Callable, T...>
+    connection connect(Callable && c, group_id gid = group_id{}) {
+        using slot_t = detail::slot<group_id, Callable, T...>;
+        return add_slot(make_slot<slot_t>(std::forward<Callable>(c), gid));
+    }
+
+    /**
+     * Connect a callable with an additional connection argument
+     * Safety: thread safe, allocates and takes the lock
+     */
+    template <typename Callable>
+    requires trait::Callable<Callable, connection&, T...>
+    connection connect_extended(Callable && c, group_id gid = group_id{}) {
+        using slot_t = detail::slot_extended<group_id, Callable, T...>;
+        auto s = make_slot<slot_t>(std::forward<Callable>(c), gid);
+        connection conn(s);
+        std::static_pointer_cast<slot_t>(s)->conn = conn;
+        add_slot(std::move(s));
+        return conn;
+    }
+
+    /**
+     * Connect a pointer over member function and an object pointer
+     * Safety: thread safe, allocates and takes the lock
+     */
+    template <typename Pmf, typename Ptr>
+    requires trait::MemberCallable<Pmf, Ptr, T...> &&
+            (!trait::Observer<Ptr> && !trait::WeakPtrCompatible<Ptr> && !trait::TrackablePtr<Ptr>)
+    connection connect(Pmf && pmf, Ptr && ptr, group_id gid = group_id{}) {
+        using slot_t = detail::slot_pmf<group_id, Pmf, Ptr, T...>;
+        return add_slot(make_slot<slot_t>(std::forward<Pmf>(pmf), std::forward<Ptr>(ptr), gid));
+    }
+
+    /**
+     * Connect a pointer over member function and a weak pointer compatible
+     * object, the slot being skipped once the object is gone
+     * Safety: thread safe, allocates and takes the lock
+     */
+    template <typename Pmf, trait::WeakPtrCompatible Ptr>
+    requires (!trait::Callable<Pmf, T...>)
+    connection connect(Pmf && pmf, Ptr && ptr, group_id gid = group_id{}) {
+        using trait::to_weak;
+        auto w = to_weak(std::forward<Ptr>(ptr));
+        using slot_t = detail::slot_pmf_tracked<group_id, Pmf, decltype(w), T...>;
+        return add_slot(make_slot<slot_t>(std::forward<Pmf>(pmf), w, gid));
+    }
+
+    /**
+     * Connect a callable whose life is tied to a weak pointer compatible
+     * object, the slot being skipped once the object is gone
+     * Safety: thread safe, allocates and takes the lock
+     */
+    template <typename Callable, trait::WeakPtrCompatible Trackable>
+    requires trait::Callable<Callable, T...>
+    connection connect(Callable && c, Trackable && ptr, group_id gid = group_id{}) {
+        using trait::to_weak;
+        auto w = to_weak(std::forward<Trackable>(ptr));
+        using slot_t = detail::slot_tracked<group_id, Callable, decltype(w), T...>;
+        return add_slot(make_slot<slot_t>(std::forward<Callable>(c), w, gid));
+    }
+
+    /**
+     * Disconnects all the slots
+     * Safety: thread safe, takes the lock
+     */
+    void disconnect_all() {
+        lock_type lock(m_mutex);
+        for (const auto &s : m_snapshot.load()->slots) {
+            s->disconnect();
+        }
+        publish(std::make_unique<snapshot>());
+    }
+
+    /**
+     * Drop the slots disconnected, or whose tracked object expired, since
+     * the last write
+     * Safety: thread safe, allocates and takes the lock
+     *
+     * @return the number of dropped slots
+     */
+    std::size_t cleanup() {
+        lock_type lock(m_mutex);
+        if (!m_dirty.exchange(false)) {
+            return 0;
+        }
+        auto next = live_slots();
+        const auto count = m_snapshot.load()->slots.size() - next->slots.size();
+        publish(std::move(next));
+        return count;
+    }
+
+    /**
+     * Number of slots in the current snapshot, including the disconnected
+     * ones not dropped yet
+     * Safety: thread safe, a single atomic load
+     */
+    [[nodiscard]] std::size_t slot_count() const noexcept {
+        return m_slot_count.load(std::memory_order_relaxed);
+    }
+
+protected:
+    // disconnections only flag the signal, slots get dropped by writers
+    void clean(detail::grouped_slot<group_id> *) override {
+        m_dirty.store(true, std::memory_order_relaxed);
+    }
+
+    void clean_all(std::span<detail::slot_state * const>) override {
+        m_dirty.store(true, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool defers_expired() const noexcept override {
+        return true;
+    }
+
+private:
+    // decrements a reader counter on scope exit
+    struct reader {
+        explicit reader(std::atomic<std::size_t> &c) noexcept
+            : count{c}
+        {
+            count.fetch_add(1);
+        }
+
+        ~reader() {
+            count.fetch_sub(1, std::memory_order_release);
+        }
+
+        reader(const reader &) = delete;
+        reader & operator=(const reader &) = delete;
+
+        std::atomic<std::size_t> &count;
+    };
+
+    // call every slot, the arguments having been converted once by the caller
+    void emit(detail::arg_t<T>... a) {
+        detail::rt_emission running{this};
+        reader r{m_readers[m_phase.load(std::memory_order_relaxed)].count};
+
+        // a writer either sees the reader count above, or publishes its
+        // snapshot before it gets loaded here
+        for (const auto &s : m_snapshot.load()->slots) {
+            s->operator()(a...);
+        }
+    }
+
+    template <typename Slot, typename... A>
+    slot_ptr make_slot(A && ...a) {
+        return detail::make_shared<slot_base, Slot>(*this, std::forward<A>(a)...);
+    }
+
+    connection add_slot(slot_ptr s) {
+        connection conn(s);
+        lock_type lock(m_mutex);
+        auto next = live_slots();
+        next->slots.reserve(next->slots.size() + 1);
+
+        // after the slots of the same group, which keeps connection order
+        auto it = std::upper_bound(next->slots.begin(), next->slots.end(), s->group(),
+                                   [](group_id gid, const slot_ptr &o) { return gid < o->group(); });
+        next->slots.insert(it, std::move(s));
+        publish(std::move(next));
+        return conn;
+    }
+
+    // to be called under lock: a copy of the current snapshot, without the
+    // slots that emissions skip for good
+    std::unique_ptr<snapshot> live_slots() {
+        auto next = std::make_unique<snapshot>();
+        const auto &cur = m_snapshot.load(std::memory_order_relaxed)->slots;
+        next->slots.reserve(cur.size());
+        for (const auto &s : cur) {
+            if (s->connected()) {
+                next->slots.push_back(s);
+            }
+        }
+        m_dirty.store(false, std::memory_order_relaxed);
+        return next;
+    }
+
+    // to be called under lock: replace the snapshot, and destroy the previous
+    // one once no emission reads it anymore
+    void publish(std::unique_ptr<snapshot> next) {
+        m_slot_count.store(next->slots.size(), std::memory_order_relaxed);
+        std::unique_ptr<snapshot> prev{m_snapshot.exchange(next.release())};
+
+        // an emission of the calling thread would never complete
+        if (detail::rt_emission::running(this)) {
+            m_graveyard.push_back(std::move(prev));
+            return;
+        }
+
+        synchronize();
+        m_graveyard.clear();
+    }
+
+    // to be called under lock: wait for the emissions that started before
+    void synchronize() {
+        const auto prev = m_phase.load(std::memory_order_relaxed);
+        const auto next = prev ^ 1U;
+
+        // emissions may still count on the idle phase, having read it before
+        // the last flip, then on the current one until the flip below
+        wait_readers(next);
+        m_phase.store(next);
+        wait_readers(prev);
+    }
+
+    void wait_readers(unsigned phase) const {
+        while (m_readers[phase].count.load() != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    struct alignas(cache_line) reader_count {
+        std::atomic<std::size_t> count{0};
+    };
+
+    Lockable m_mutex;
+    std::atomic<snapshot *> m_snapshot;
+    alignas(cache_line) std::atomic<unsigned> m_phase{0};
+    reader_count m_readers[2];
+    std::atomic<std::size_t> m_slot_count{0};
+    std::atomic<bool> m_dirty{false};
+    std::vector<std::unique_ptr<snapshot>> m_graveyard;  // waiting for a grace period
+};
+
+/**
+ * Specialization of rt_signal_base for writers locking a standard mutex
+ */
+template <typename... T>
+using rt_signal = rt_signal_base<std::mutex, T...>;
+
+} // namespace sigslot
@@ -0,0 +1,309 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sigslot {
+
+template <typename T>
+class shared_payload;
+
+template <typename T>
+class unique_payload;
+
+template <typename T>
+class payload_pool;
+
+namespace detail {
+
+template <typename T>
+struct payload_pool_core;
+
+/*
+ * A payload_block holds both the reference count and the value of a payload,
+ * so that a payload costs a single allocation. Blocks handed out by a pool
+ * keep a reference to it while they are in use, in order to be recycled
+ * instead of freed when the last reference goes away.
+ */
+template <typename T>
+struct payload_block {
+    template <typename... A>
+    explicit payload_block(A && ...a)
+        : value(std::forward<A>(a)...)
+    {}
+
+    std::atomic<std::size_t> refs{1};
+    std::shared_ptr<payload_pool_core<T>> pool;
+    T value;
+};
+
+template <typename T>
+struct payload_pool_core {
+    explicit payload_pool_core(std::size_t max_idle)
+        : m_max_idle(max_idle)
+    {}
+
+    payload_pool_core(const payload_pool_core &) = delete;
+    payload_pool_core & operator=(const payload_pool_core &) = delete;
+
+    ~payload_pool_core() {
+        for (auto *b : m_idle) {
+            delete b;
+        }
+    }
+
+    payload_block<T> * acquire() {
+        {
+            std::lock_guard<std::mutex> _{m_mutex};
+            if (!m_idle.empty()) {
+                auto *b = m_idle.back();
+                m_idle.pop_back();
+                ++m_recycled;
+                return b;
+            }
+            ++m_allocated;
+        }
+        return new payload_block<T>();
+    }
+
+    void recycle(payload_block<T> *b) noexcept {
+        {
+            std::lock_guard<std::mutex> _{m_mutex};
+            if (m_idle.size() < m_max_idle) {
+                m_idle.push_back(b);
+                return;
+            }
+        }
+        delete b;
+    }
+
+    std::mutex m_mutex;
+    std::vector<payload_block<T> *> m_idle;
+    std::size_t m_max_idle;
+    std::size_t m_allocated = 0;
+    std::size_t m_recycled = 0;
+};
+
+template <typename T>
+void retain(payload_block<T> *b) noexcept {
+    if (b) {
+        b->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+void release(payload_block<T> *b) noexcept {
+    if (!b || b->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    if (b->pool) {
+        // the pool may go away along with our reference to it, after recycling
+        auto pool = std::move(b->pool);
+        b->refs.store(1, std::memory_order_relaxed);
+        pool->recycle(b);
+    } else {
+        delete b;
+    }
+}
+
+} // namespace detail
+
+/**
+ * unique_payload is the mutable, move-only form of a payload, used to fill
+ * a buffer before sharing it. It converts to a shared_payload.
+ */
+template <typename T>
+class unique_payload {
+public:
+    unique_payload() noexcept = default;
+
+    template <typename... A>
+    requires std::is_constructible_v<T, A...>
+    static unique_payload make(A && ...a) {
+        return unique_payload{new detail::payload_block<T>(std::forward<A>(a)...)};
+    }
+
+    unique_payload(const unique_payload &) = delete;
+    unique_payload & operator=(const unique_payload &) = delete;
+
+    unique_payload(unique_payload && o) noexcept
+        : m_block{std::exchange(o.m_block, nullptr)}
+    {}
+
+    unique_payload & operator=(unique_payload && o) noexcept {
+        unique_payload tmp{std::move(o)};
+        std::swap(m_block, tmp.m_block);
+        return *this;
+    }
+
+    ~unique_payload() {
+        detail::release(m_block);
+    }
+
+    T & operator*() const noexcept { return m_block->value; }
+    T * operator->() const noexcept { return &m_block->value; }
+    T * get() const noexcept { return m_block ? &m_block->value : nullptr; }
+
+    explicit operator bool() const noexcept { return m_block != nullptr; }
+
+private:
+    friend class shared_payload<T>;
+    friend class payload_pool<T>;
+
+    explicit unique_payload(detail::payload_block<T> *b) noexcept
+        : m_block{b}
+    {}
+
+    detail::payload_block<T> *m_block = nullptr;
+};
+
+/**
+ * shared_payload is a reference counted handle over an immutable value, meant
+ * to carry large payloads to many slots.
+ *
+ * The value and its reference count live in a single allocation. Handing a
+ * shared_payload to a slot taking it by const reference costs nothing, and
+ * copying it, for instance in a queued slot, only bumps the reference count.
+ *
+ * A shared_payload can be implicitly built from a value, so that emitting a
+ * value on a signal of shared_payload<T> allocates once, whatever the number
+ * of slots. It also converts to a const reference to the value, hence slots
+ * expecting a const T& can be connected to such a signal directly.
+ */
+template <typename T>
+class shared_payload {
+public:
+    using element_type = T;
+
+    shared_payload() noexcept = default;
+
+    // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+    /*implicit*/ shared_payload(const T &v)
+        : m_block{new detail::payload_block<T>(v)}
+    {}
+
+    // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+    /*implicit*/ shared_payload(T &&v)
+        : m_block{new detail::payload_block<T>(std::move(v))}
+    {}
+
+    // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+    /*implicit*/ shared_payload(unique_payload<T> &&u) noexcept
+        : m_block{std::exchange(u.m_block, nullptr)}
+    {}
+
+    template <typename... A>
+    requires std::is_constructible_v<T, A...>
+    static shared_payload make(A && ...a) {
+        return unique_payload<T>::make(std::forward<A>(a)...);
+    }
+
+    shared_payload(const shared_payload &o) noexcept
+        : m_block{o.m_block}
+    {
+        detail::retain(m_block);
+    }
+
+    shared_payload(shared_payload && o) noexcept
+        : m_block{std::exchange(o.m_block, nullptr)}
+    {}
+
+    shared_payload & operator=(const shared_payload &o) noexcept {
+        if (&o != this) {
+            *this = shared_payload(o);
+        }
+        return *this;
+    }
+
+    shared_payload & operator=(shared_payload && o) noexcept {
+        shared_payload tmp{std::move(o)};
+        std::swap(m_block, tmp.m_block);
+        return *this;
+    }
+
+    ~shared_payload() {
+        detail::release(m_block);
+    }
+
+    const T & operator*() const noexcept { return m_block->value; }
+    const T * operator->() const noexcept { return &m_block->value; }
+    const T * get() const noexcept { return m_block ? &m_block->value : nullptr; }
+
+    // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+    /*implicit*/ operator const T &() const noexcept { return m_block->value; }
+
+    explicit operator bool() const noexcept { return m_block != nullptr; }
+
+    [[nodiscard]] std::size_t use_count() const noexcept {
+        return m_block ? m_block->refs.load(std::memory_order_relaxed) : 0;
+    }
+
+private:
+    detail::payload_block<T> *m_block = nullptr;
+};
+
+template <typename T, typename... A>
+shared_payload<T> make_shared_payload(A && ...a) {
+    return shared_payload<T>::make(std::forward<A>(a)...);
+}
+
+/**
+ * payload_pool recycles payload buffers instead of freeing them once the last
+ * shared_payload referencing them goes away.
+ *
+ * Recycled values are not reset: a value obtained from acquire() is either
+ * default constructed or left as it was when released, which allows reusing
+ * the capacity of containers. The pool may be destroyed while some of its
+ * payloads are still in use, they are freed when released.
+ */
+template <typename T>
+class payload_pool {
+public:
+    static_assert(std::is_default_constructible_v<T>,
+                  "pooled payloads must be default constructible");
+
+    explicit payload_pool(std::size_t max_idle = 16)
+        : m_core{std::make_shared<detail::payload_pool_core<T>>(max_idle)}
+    {}
+
+    /**
+     * Get a payload for writing, recycling a released one if possible
+     * Safety: thread safe
+     */
+    unique_payload<T> acquire() {
+        auto *b = m_core->acquire();
+        b->pool = m_core;
+        return unique_payload<T>{b};
+    }
+
+    /**
+     * Number of released payloads waiting to be reused
+     */
+    [[nodiscard]] std::size_t idle() const {
+        std::lock_guard<std::mutex> _{m_core->m_mutex};
+        return m_core->m_idle.size();
+    }
+
+    /**
+     * Number of payloads allocated and recycled by the pool so far
+     */
+    [[nodiscard]] std::size_t allocated() const {
+        std::lock_guard<std::mutex> _{m_core->m_mutex};
+        return m_core->m_allocated;
+    }
+
+    [[nodiscard]] std::size_t recycled() const {
+        std::lock_guard<std::mutex> _{m_core->m_mutex};
+        return m_core->m_recycled;
+    }
+
+private:
+    std::shared_ptr<detail::payload_pool_core<T>> m_core;
+};
+
+} // namespace sigslot
@@ -1,13 +1,27 @@
 #pragma once
+#include <algorithm>
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <type_traits>
 #include <utility>
 #include <thread>
 #include <vector>
 #include <optional>
 #include <concepts>
+#include <tuple>
+#include <span>
+#include <coroutine>
+#include <exception>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 
 #if defined __clang__ || (__GNUC__ > 5)
 #define SIGSLOT_MAY_ALIAS __attribute__((__may_alias__))
@@ -15,6 +29,20 @@
 #define SIGSLOT_MAY_ALIAS
 #endif
 
+// SIMD comparison of the disconnection keys, see detail::find_keys()
+#if !defined(SIGSLOT_DISABLE_SIMD) && defined(__AVX2__)
+#define SIGSLOT_SIMD_AVX2 1
+#include <immintrin.h>
+#elif !defined(SIGSLOT_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SIGSLOT_SIMD_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// a pause instruction for spinning threads, see detail::cpu_relax()
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
 #if defined(__GXX_RTTI) || defined(__cpp_rtti) || defined(_CPPRTTI)
 #define SIGSLOT_RTTI_ENABLED 1
 #include <typeinfo>
@@ -27,6 +55,9 @@ namespace detail {
 // Used to detect an object of observer type
 struct observer_type {};
 
+// Used to detect an object of trackable type
+struct trackable_type {};
+
 } // namespace detail
 
 namespace trait {
@@ -93,6 +124,33 @@ template<typename T>
 concept Observer = std::is_base_of_v<::sigslot::detail::observer_type,
                                      std::remove_pointer_t<T>>;
 
+/**
+ * A pointer to an object deriving from sigslot::trackable
+ */
+template<typename T>
+concept TrackablePtr = std::is_pointer_v<std::decay_t<T>> &&
+                       std::is_base_of_v<::sigslot::detail::trackable_type,
+                                         std::remove_cv_t<std::remove_pointer_t<std::decay_t<T>>>>;
+
+/**
+ * An executor accepts nullary tasks through a post() method, to be run later,
+ * presumably from another thread. Thread pools and event loops are examples
+ * of executors.
+ */
+template<typename E>
+concept Executor = requires(E &e, std::function<void()> f) {
+    e.post(std::move(f));
+};
+
+/**
+ * A parallel executor runs a function over a range of indices concurrently,
+ * and returns once every call has completed.
+ */
+template<typename P>
+concept ParallelExecutor = requires(P &p, std::size_t n, void (*f)(std::size_t)) {
+    p.parallel_for(n, f);
+};
+
 } // namespace trait
 
 template<typename T>
@@ -103,9 +161,285 @@ concept GroupId = requires(T g1, T g2) {
     { g1 == g2 } -> std::same_as<bool>;
 };
 
+/**
+ * How a signal stream buffers the emissions its consumer has not caught up with
+ */
+enum class ConflationPolicy {
+    KEEP_ALL,     // buffer emissions in order, dropping the oldest when full
+    KEEP_LATEST,  // only keep the latest emission
+};
+
+template <typename R = void>
+class task;
+
+namespace detail {
+
+/*
+ * An async_join counts the slots started by an asynchronous emission, and
+ * resumes the emitting coroutine once all of them have completed. The count
+ * starts at one on behalf of the emitting coroutine, which gives it up when
+ * it awaits the join.
+ */
+struct async_join {
+    async_join() = default;
+    async_join(const async_join &) = delete;
+    async_join & operator=(const async_join &) = delete;
+
+    void add() noexcept {
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // called by a completed slot, returns the coroutine to resume next
+    std::coroutine_handle<> arrive(std::exception_ptr e) noexcept {
+        if (e) {
+            std::lock_guard<std::mutex> _{mutex};
+            if (!error) {
+                error = std::move(e);
+            }
+        }
+        if (count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            return waiter;
+        }
+        return std::noop_coroutine();
+    }
+
+    [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> h) noexcept {
+        waiter = h;
+        return count.fetch_sub(1, std::memory_order_acq_rel) != 1;
+    }
+
+    void await_resume() const {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    std::atomic<std::size_t> count{1};
+    std::coroutine_handle<> waiter;
+    std::mutex mutex;
+    std::exception_ptr error;
+};
+
+/*
+ * The promise of a task. A task is lazy, it starts when awaited and resumes
+ * its awaiter on completion. A launched task owns itself instead: it starts
+ * right away, destroys itself on completion and reports to its join if any.
+ */
+struct task_promise_base {
+    struct final_awaiter {
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+        template <typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> h) noexcept {
+            auto &p = h.promise();
+            if (p.continuation) {
+                return p.continuation;
+            }
+            if (!p.launched) {
+                return std::noop_coroutine();
+            }
+
+            auto *join = p.join;
+            auto error = std::move(p.error);
+            h.destroy();
+            return join ? join->arrive(std::move(error)) : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    final_awaiter final_suspend() const noexcept { return {}; }
+
+    void unhandled_exception() noexcept {
+        error = std::current_exception();
+    }
+
+    void rethrow_if_failed() const {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    std::coroutine_handle<> continuation;
+    async_join *join = nullptr;
+    bool launched = false;
+    std::exception_ptr error;
+};
+
+template <typename R>
+struct task_promise : task_promise_base {
+    task<R> get_return_object() noexcept;
+
+    template <typename U>
+    void return_value(U && v) {
+        value.emplace(std::forward<U>(v));
+    }
+
+    R result() {
+        rethrow_if_failed();
+        return std::move(*value);
+    }
+
+    std::optional<R> value;
+};
+
+template <>
+struct task_promise<void> : task_promise_base {
+    task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept {}
+
+    void result() const {
+        rethrow_if_failed();
+    }
+};
+
+template <typename T>
+struct is_task : std::false_type {};
+
+template <typename R>
+struct is_task<task<R>> : std::true_type {};
+
+template <typename R>
+void launch(task<R> t, async_join *join) noexcept;
+
+} // namespace detail
+
+/**
+ * task is a lazily started coroutine, used for asynchronous slots and
+ * asynchronous emission. It starts when awaited, and resumes its awaiter
+ * upon completion, handing it the coroutine result or exception.
+ */
+template <typename R>
+class [[nodiscard]] task {
+public:
+    using promise_type = detail::task_promise<R>;
+
+    task() noexcept = default;
+
+    task(const task &) = delete;
+    task & operator=(const task &) = delete;
+
+    task(task && o) noexcept
+        : m_handle{std::exchange(o.m_handle, {})}
+    {}
+
+    task & operator=(task && o) noexcept {
+        if (this != &o) {
+            reset();
+            m_handle = std::exchange(o.m_handle, {});
+        }
+        return *this;
+    }
+
+    ~task() {
+        reset();
+    }
+
+    /**
+     * Whether the coroutine has run to completion, or there is none
+     */
+    [[nodiscard]] bool done() const noexcept {
+        return !m_handle || m_handle.done();
+    }
+
+    auto operator co_await() const noexcept {
+        struct awaiter {
+            [[nodiscard]] bool await_ready() const noexcept {
+                return h.done();
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> c) noexcept {
+                h.promise().continuation = c;
+                return h;
+            }
+
+            R await_resume() {
+                return h.promise().result();
+            }
+
+            std::coroutine_handle<promise_type> h;
+        };
+
+        return awaiter{m_handle};
+    }
+
+private:
+    friend promise_type;
+
+    template <typename U>
+    friend void detail::launch(task<U>, detail::async_join *) noexcept;
+
+    explicit task(std::coroutine_handle<promise_type> h) noexcept
+        : m_handle{h}
+    {}
+
+    void reset() noexcept {
+        if (m_handle) {
+            m_handle.destroy();
+            m_handle = {};
+        }
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+namespace detail {
+
+template <typename R>
+task<R> task_promise<R>::get_return_object() noexcept {
+    return task<R>{std::coroutine_handle<task_promise>::from_promise(*this)};
+}
+
+inline task<void> task_promise<void>::get_return_object() noexcept {
+    return task<void>{std::coroutine_handle<task_promise>::from_promise(*this)};
+}
+
+// start a task that owns itself, reporting its completion to join if any
+template <typename R>
+void launch(task<R> t, async_join *join) noexcept {
+    auto h = std::exchange(t.m_handle, {});
+    if (!h) {
+        return;
+    }
+
+    h.promise().launched = true;
+    h.promise().join = join;
+    if (join) {
+        join->add();
+    }
+    h.resume();
+}
+
+} // namespace detail
+
+namespace trait {
+
+/**
+ * A batch callable processes a whole batch of emissions at once, as a span
+ * of argument tuples
+ */
+template<typename F, typename... T>
+concept BatchCallable = std::is_invocable_v<F&, std::span<const std::tuple<T...>>>;
+
+/**
+ * An asynchronous callable returns a task when called
+ */
+template<typename F, typename... T>
+concept AsyncCallable = std::is_invocable_v<F&, T...> &&
+                        ::sigslot::detail::is_task<std::invoke_result_t<F&, T...>>::value;
+
+} // namespace trait
+
 template <GroupId, typename, typename...>
 class signal_base;
 
+template <typename, typename...>
+class rt_signal_base;
+
 namespace detail {
 
 /**
@@ -282,6 +616,77 @@ obj_ptr get_object_ptr(const T &t) {
     return object_pointer<T>::get(t);
 }
 
+/*
+ * Find the keys equal to k in a packed array, comparing their bytes the way
+ * func_ptr and obj_ptr do, and call f with the index of each of them. Keys
+ * the size of a pointer or of two are compared several at a time with SIMD
+ * instructions where available, unless SIGSLOT_DISABLE_SIMD is defined.
+ */
+template <typename Key, typename F>
+void find_keys_scalar(const Key *keys, std::size_t n, const Key &k, F &&f, std::size_t i = 0) {
+    for (; i < n; ++i) {
+        if (std::memcmp(keys + i, &k, sizeof(Key)) == 0) {
+            f(i);
+        }
+    }
+}
+
+template <typename Key, typename F>
+void find_keys(const Key *keys, std::size_t n, const Key &k, F &&f) {
+    static_assert(std::is_trivially_copyable_v<Key>);
+    std::size_t i = 0;
+
+#if defined(SIGSLOT_SIMD_AVX2)
+    if constexpr (sizeof(Key) == 16) {
+        const auto kk = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&k)));
+        for (; i + 2 <= n; i += 2) {
+            const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(keys + i));
+            const auto m = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, kk)));
+            if ((m & 0xFFFFU) == 0xFFFFU) {
+                f(i);
+            }
+            if ((m >> 16) == 0xFFFFU) {
+                f(i + 1);
+            }
+        }
+    } else if constexpr (sizeof(Key) == 8) {
+        const auto kk = _mm256_set1_epi64x(std::bit_cast<long long>(k));
+        for (; i + 4 <= n; i += 4) {
+            const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(keys + i));
+            auto m = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v, kk))));
+            for (; m; m &= m - 1) {
+                f(i + static_cast<std::size_t>(std::countr_zero(m)));
+            }
+        }
+    }
+#elif defined(SIGSLOT_SIMD_SSE2)
+    if constexpr (sizeof(Key) == 16) {
+        const auto kk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&k));
+        for (; i < n; ++i) {
+            const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, kk)) == 0xFFFF) {
+                f(i);
+            }
+        }
+    } else if constexpr (sizeof(Key) == 8) {
+        // no 64 bits comparison before SSE4.1, both halves must match
+        const auto kk = _mm_set1_epi64x(std::bit_cast<long long>(k));
+        for (; i + 2 <= n; i += 2) {
+            const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i));
+            const auto m = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, kk)));
+            if ((m & 0x3) == 0x3) {
+                f(i);
+            }
+            if ((m & 0xC) == 0xC) {
+                f(i + 1);
+            }
+        }
+    }
+#endif
+
+    find_keys_scalar(keys, n, k, f, i);
+}
+
 // noop mutex for thread-unsafe use
 struct null_mutex {
     null_mutex() noexcept = default;
@@ -299,7 +704,8 @@ struct null_mutex {
 /**
  * A spin mutex that yields, mostly for use in benchmarks and scenarii that invoke
  * slots at a very high pace.
- * One should almost always prefer a standard mutex over this.
+ * One should almost always prefer a standard mutex, or an adaptive_mutex, over
+ * this, as it keeps burning cpu time for as long as the lock is taken.
  */
 struct spin_mutex {
     spin_mutex() noexcept = default;
@@ -333,111 +739,519 @@ private:
     std::atomic<bool> state {true};
 };
 
+// tell the processor that the calling thread spins, easing the pressure on
+// the sibling hyperthread and on the memory bus
+inline void cpu_relax() noexcept {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_ia32_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__aarch64__) || defined(__arm__))
+    asm volatile("yield");
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#endif
+}
+
 /**
- * A simple copy on write container that will be used to improve slot lists
- * access efficiency in a multithreaded context.
+ * The contention met by a basic_adaptive_mutex<true>
  */
-template <typename T>
-class copy_on_write {
-    struct payload {
-        payload() = default;
-
-        template <typename... Args>
-        explicit payload(Args && ...args)
-            : value(std::forward<Args>(args)...)
-        {}
-
-        // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
-        std::atomic<std::size_t> count{1};
-        T value{}; // NOLINT(misc-non-private-member-variables-in-classes)
-    };
+struct lock_stats {
+    std::uint64_t acquisitions = 0;  // successful lock() and try_lock() calls
+    std::uint64_t contended = 0;     // lock() calls that found the mutex taken
+    std::uint64_t parked = 0;        // times lock() put its thread to sleep
+};
 
+/**
+ * A mutex that spins briefly, then puts the waiting thread to sleep.
+ *
+ * A contended lock() spins in rounds of exponentially more pause instructions,
+ * then parks the thread on the lock word with std::atomic::wait, which is a
+ * futex on Linux. The number of rounds adapts to the lock: it grows back when
+ * spinning pays off, and shrinks whenever a thread had to park, so that a lock
+ * held for long, or contended by more threads than there are cores, stops
+ * burning cpu time. Unlocking only wakes a thread if one may be sleeping.
+ *
+ * @tparam Counted whether to keep contention counters, read with stats()
+ */
+template <bool Counted>
+class basic_adaptive_mutex {
 public:
-    using element_type = T;
-
-    copy_on_write()
-        : m_data(new payload)
-    {}
+    static constexpr unsigned max_spin_rounds = 8;  // up to 2^8 pauses a round
 
-    template <typename U>
-    requires (!std::same_as<std::decay_t<U>, copy_on_write>)
-    explicit copy_on_write(U && x)
-        : m_data(new payload(std::forward<U>(x)))
-    {}
-
-    copy_on_write(const copy_on_write &x) noexcept
-        : m_data(x.m_data)
-    {
-        ++m_data->count;
-    }
+    basic_adaptive_mutex() noexcept = default;
+    ~basic_adaptive_mutex() noexcept = default;
+    basic_adaptive_mutex(const basic_adaptive_mutex &) = delete;
+    basic_adaptive_mutex& operator=(const basic_adaptive_mutex &) = delete;
+    basic_adaptive_mutex(basic_adaptive_mutex &&) = delete;
+    basic_adaptive_mutex& operator=(basic_adaptive_mutex &&) = delete;
 
-    copy_on_write(copy_on_write && x) noexcept
-        : m_data(x.m_data)
-    {
-        x.m_data = nullptr;
+    void lock() noexcept {
+        std::uint32_t c = unlocked;
+        if (m_state.compare_exchange_strong(c, locked, std::memory_order_acquire,
+                                                        std::memory_order_relaxed)) {
+            count(0, false);
+            return;
+        }
+        lock_contended();
     }
 
-    ~copy_on_write() {
-        if (m_data && (--m_data->count == 0)) {
-            delete m_data;
-            m_data = nullptr;
+    bool try_lock() noexcept {
+        std::uint32_t c = unlocked;
+        if (m_state.compare_exchange_strong(c, locked, std::memory_order_acquire,
+                                                        std::memory_order_relaxed)) {
+            count(0, false);
+            return true;
         }
+        return false;
     }
 
-    copy_on_write& operator=(const copy_on_write &x) noexcept {
-        if (&x != this) {
-            *this = copy_on_write(x);
+    void unlock() noexcept {
+        if (m_state.exchange(unlocked, std::memory_order_release) == sleepers) {
+            m_state.notify_one();
         }
-        return *this;
     }
 
-    copy_on_write& operator=(copy_on_write && x) noexcept  {
-        auto tmp = std::move(x);
-        swap(*this, tmp);
-        return *this;
+    /**
+     * The contention met so far
+     * Safety: thread safe, the counters being read without synchronization
+     */
+    [[nodiscard]] lock_stats stats() const noexcept requires Counted {
+        return {m_acquisitions.load(std::memory_order_relaxed),
+                m_contended.load(std::memory_order_relaxed),
+                m_parked.load(std::memory_order_relaxed)};
     }
 
-    element_type& write() {
-        if (!unique()) {
-            *this = copy_on_write(read());
+private:
+    static constexpr std::uint32_t unlocked = 0;
+    static constexpr std::uint32_t locked = 1;
+    static constexpr std::uint32_t sleepers = 2;  // locked, threads may sleep
+
+    void lock_contended() noexcept {
+        const unsigned rounds = m_spin_rounds.load(std::memory_order_relaxed);
+        for (unsigned r = 0; r < rounds; ++r) {
+            for (unsigned i = 0; i < (1U << r); ++i) {
+                cpu_relax();
+            }
+            std::uint32_t c = m_state.load(std::memory_order_relaxed);
+            if (c == unlocked && m_state.compare_exchange_weak(c, locked, std::memory_order_acquire,
+                                                                          std::memory_order_relaxed)) {
+                // spinning paid off, allow one round more next time
+                m_spin_rounds.store(std::min(r + 2, max_spin_rounds), std::memory_order_relaxed);
+                count(0, true);
+                return;
+            }
         }
-        // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
-        return m_data->value; // TODO(CK) error: Use of memory after it is freed?
-    }
 
-    [[nodiscard]] const element_type& read() const noexcept {
-        // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
-        return m_data->value; // TODO(CK) error: Use of memory after it is freed?
+        // the lock stays taken as sleepers, unlock() then wakes a thread up
+        std::uint64_t parked = 0;
+        while (m_state.exchange(sleepers, std::memory_order_acquire) != unlocked) {
+            ++parked;
+            m_state.wait(sleepers, std::memory_order_relaxed);
+        }
+        if (parked > 0 && rounds > 1) {
+            m_spin_rounds.store(rounds - 1, std::memory_order_relaxed);
+        }
+        count(parked, true);
     }
 
-    friend inline void swap(copy_on_write &x, copy_on_write &y) noexcept {
-        std::swap(x.m_data, y.m_data);
+    // to be called with the lock held, so that the counters have one writer
+    void count([[maybe_unused]] std::uint64_t parked, [[maybe_unused]] bool contended) noexcept {
+        if constexpr (Counted) {
+            bump(m_acquisitions, 1);
+            bump(m_contended, contended ? 1 : 0);
+            bump(m_parked, parked);
+        }
     }
 
-private:
-    [[nodiscard]] bool unique() const noexcept {
-        return m_data->count == 1;
+    static void bump(std::atomic<std::uint64_t> &c, std::uint64_t n) noexcept {
+        c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
     }
 
-private:
-    payload *m_data;
+    struct no_counter {};
+    using counter = std::conditional_t<Counted, std::atomic<std::uint64_t>, no_counter>;
+
+    std::atomic<std::uint32_t> m_state{unlocked};
+    std::atomic<unsigned> m_spin_rounds{max_spin_rounds};
+    [[no_unique_address]] counter m_acquisitions{};
+    [[no_unique_address]] counter m_contended{};
+    [[no_unique_address]] counter m_parked{};
 };
 
-/**
- * Specializations for thread-safe code path
+using adaptive_mutex = basic_adaptive_mutex<false>;
+using counted_adaptive_mutex = basic_adaptive_mutex<true>;
+
+/*
+ * Epoch based quiescence of the threads calling trackable slots, which lets
+ * a trackable object wait for the calls in flight before being destroyed.
+ *
+ * Emissions that may call such slots run in a read-side section, tagged in
+ * the record of the emitting thread with the global epoch at its start.
+ * Waiting for quiescence bumps the epoch and waits until no thread runs a
+ * section tagged with an older one. A section started after the bump is
+ * ordered after whatever preceded it, such as clearing the alive flag of an
+ * object, so that its slots read the flag with a relaxed load.
  */
-template <typename T>
-const T& cow_read(const T &v) {
-    return v;
-}
+class quiescence_domain {
+public:
+    struct record {
+        std::atomic<std::uint64_t> epoch{0};  // 0 outside of a section
+        unsigned nesting = 0;                 // only used by the owning thread
+        record *prev = nullptr;
+        record *next = nullptr;
+    };
 
-template <typename T>
-const T& cow_read(copy_on_write<T> &v) {
-    return v.read();
-}
+    static quiescence_domain & instance() {
+        static quiescence_domain domain;
+        return domain;
+    }
 
-template <typename T>
-T& cow_write(T &v) {
+    void enter(record &r) noexcept {
+        if (r.nesting++ > 0) {
+            return;
+        }
+        // publish the epoch, then check that it did not move in between,
+        // otherwise a concurrent wait may have missed the section
+        auto e = m_epoch.load();
+        for (;;) {
+            r.epoch.store(e);
+            const auto now = m_epoch.load();
+            if (now == e) {
+                break;
+            }
+            e = now;
+        }
+    }
+
+    void leave(record &r) noexcept {
+        if (--r.nesting == 0) {
+            r.epoch.store(0, std::memory_order_release);
+        }
+    }
+
+    // wait for the sections running at the time of the call to end, but the
+    // one of the calling thread, which would never end otherwise
+    void synchronize() {
+        const auto target = m_epoch.fetch_add(1) + 1;
+        const record *self = t_self;
+
+        std::lock_guard<std::mutex> _{m_mutex};
+        for (const auto *r = m_head; r; r = r->next) {
+            if (r == self) {
+                continue;
+            }
+            for (;;) {
+                const auto e = r->epoch.load();
+                if (e == 0 || e >= target) {
+                    break;
+                }
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void enroll(record &r) {
+        std::lock_guard<std::mutex> _{m_mutex};
+        r.next = m_head;
+        if (m_head) {
+            m_head->prev = &r;
+        }
+        m_head = &r;
+        t_self = &r;
+    }
+
+    void retire(record &r) noexcept {
+        std::lock_guard<std::mutex> _{m_mutex};
+        if (r.prev) {
+            r.prev->next = r.next;
+        } else {
+            m_head = r.next;
+        }
+        if (r.next) {
+            r.next->prev = r.prev;
+        }
+        t_self = nullptr;
+    }
+
+private:
+    std::mutex m_mutex;
+    record *m_head = nullptr;
+    std::atomic<std::uint64_t> m_epoch{1};
+    static inline thread_local const record *t_self = nullptr;
+};
+
+// the record of the calling thread, enrolled on first use
+inline quiescence_domain::record & this_thread_record() {
+    struct enrolled : quiescence_domain::record {
+        enrolled() { quiescence_domain::instance().enroll(*this); }
+        ~enrolled() { quiescence_domain::instance().retire(*this); }
+        enrolled(const enrolled &) = delete;
+        enrolled & operator=(const enrolled &) = delete;
+    };
+    thread_local enrolled r;
+    return r;
+}
+
+// a read-side section of the quiescence domain, entered on demand
+class read_section {
+public:
+    explicit read_section(bool enter)
+        : m_record{enter ? &this_thread_record() : nullptr}
+    {
+        if (m_record) {
+            quiescence_domain::instance().enter(*m_record);
+        }
+    }
+
+    ~read_section() {
+        if (m_record) {
+            quiescence_domain::instance().leave(*m_record);
+        }
+    }
+
+    read_section(const read_section &) = delete;
+    read_section & operator=(const read_section &) = delete;
+
+private:
+    quiescence_domain::record *m_record;
+};
+
+// an object whose destruction may be deferred to a reclaimer
+struct retired {
+    retired() = default;
+    retired(const retired &) = delete;
+    retired & operator=(const retired &) = delete;
+    virtual ~retired() = default;
+
+    retired *next = nullptr;
+};
+
+} // namespace detail
+
+/**
+ * A reclaimer collects objects dropped by emitting threads, such as slot lists
+ * and the slots they were the last owners of, and destroys them on reclaim().
+ *
+ * Retiring an object pushes it on a lock-free stack, without allocating, so
+ * that threads which must not free memory, such as real-time ones, leave that
+ * work to a thread of choice. Whatever is left gets destroyed along with the
+ * reclaimer.
+ */
+class reclaimer {
+public:
+    reclaimer() = default;
+    reclaimer(const reclaimer &) = delete;
+    reclaimer & operator=(const reclaimer &) = delete;
+
+    ~reclaimer() {
+        reclaim();
+    }
+
+    /**
+     * Hand an object over for later destruction
+     * Safety: thread safe, lock-free
+     */
+    void retire(detail::retired *r) noexcept {
+        auto *head = m_head.load(std::memory_order_relaxed);
+        do {
+            r->next = head;
+        } while (!m_head.compare_exchange_weak(head, r, std::memory_order_release,
+                                                        std::memory_order_relaxed));
+    }
+
+    /**
+     * Destroy the objects retired so far
+     * Safety: thread safe
+     *
+     * @return the number of destroyed objects
+     */
+    std::size_t reclaim() noexcept {
+        return destroy(detach());
+    }
+
+    /**
+     * Take the objects retired so far, to be destroyed later with destroy(),
+     * such as after waiting for the threads that may still reach them
+     * Safety: thread safe, lock-free
+     */
+    [[nodiscard]] detail::retired * detach() noexcept {
+        return m_head.exchange(nullptr, std::memory_order_acquire);
+    }
+
+    /**
+     * Destroy a list of objects obtained from detach()
+     *
+     * @return the number of destroyed objects
+     */
+    static std::size_t destroy(detail::retired *r) noexcept {
+        std::size_t count = 0;
+        while (r) {
+            delete std::exchange(r, r->next);
+            ++count;
+        }
+        return count;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return m_head.load(std::memory_order_relaxed) == nullptr;
+    }
+
+private:
+    std::atomic<detail::retired *> m_head{nullptr};
+};
+
+namespace detail {
+
+/**
+ * A simple copy on write container that will be used to improve slot lists
+ * access efficiency in a multithreaded context.
+ *
+ * The last owner of a value destroys it, unless a reclaimer got attached to
+ * the container, in which case the value gets retired to it.
+ */
+template <typename T>
+class copy_on_write {
+    struct payload : retired {
+        payload() = default;
+
+        template <typename... Args>
+        explicit payload(Args && ...args)
+            : value(std::forward<Args>(args)...)
+        {}
+
+        // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+        std::atomic<std::size_t> count{1};
+        std::atomic<reclaimer *> reclaim{nullptr}; // NOLINT(misc-non-private-member-variables-in-classes)
+        T value{}; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+public:
+    using element_type = T;
+
+    copy_on_write()
+        : m_data(new payload)
+    {}
+
+    template <typename U>
+    requires (!std::same_as<std::decay_t<U>, copy_on_write>)
+    explicit copy_on_write(U && x)
+        : m_data(new payload(std::forward<U>(x)))
+    {}
+
+    copy_on_write(const copy_on_write &x) noexcept
+        : m_data(x.data())
+    {
+        ++data()->count;
+    }
+
+    copy_on_write(copy_on_write && x) noexcept
+        : m_data(x.m_data.exchange(nullptr, std::memory_order_relaxed))
+    {}
+
+    ~copy_on_write() {
+        auto *p = data();
+        if (p && (--p->count == 0)) {
+            dispose(p);
+        }
+    }
+
+    copy_on_write& operator=(const copy_on_write &x) noexcept {
+        if (&x != this) {
+            *this = copy_on_write(x);
+        }
+        return *this;
+    }
+
+    copy_on_write& operator=(copy_on_write && x) noexcept  {
+        auto tmp = std::move(x);
+        swap(*this, tmp);
+        return *this;
+    }
+
+    element_type& write() {
+        if (!unique()) {
+            copy_on_write c(read());
+            c.data()->reclaim.store(data()->reclaim.load(std::memory_order_relaxed),
+                                    std::memory_order_relaxed);
+            *this = std::move(c);
+        }
+        // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
+        return data()->value; // TODO(CK) error: Use of memory after it is freed?
+    }
+
+    [[nodiscard]] const element_type& read() const noexcept {
+        // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
+        return data()->value; // TODO(CK) error: Use of memory after it is freed?
+    }
+
+    friend inline void swap(copy_on_write &x, copy_on_write &y) noexcept {
+        auto *p = x.data();
+        x.m_data.store(y.data(), std::memory_order_release);
+        y.m_data.store(p, std::memory_order_release);
+    }
+
+    // retire the values dropped from now on to a reclaimer, if not null
+    void set_reclaimer(reclaimer *r) noexcept {
+        data()->reclaim.store(r, std::memory_order_relaxed);
+    }
+
+    /*
+     * A copy taken without holding the lock of the writers, which may replace
+     * the value concurrently. Empty if the value was being dropped, in which
+     * case it must be taken again. The caller keeps writers from destroying
+     * the value meanwhile, see seqlock.
+     */
+    [[nodiscard]] std::optional<copy_on_write> try_copy() const noexcept {
+        auto *p = m_data.load(std::memory_order_acquire);
+        auto c = p->count.load();
+        do {
+            // never revive a value whose last owner is retiring it
+            if (c == 0) {
+                return std::nullopt;
+            }
+        } while (!p->count.compare_exchange_weak(c, c + 1));
+        return copy_on_write(p);
+    }
+
+private:
+    explicit copy_on_write(payload *p) noexcept
+        : m_data(p)
+    {}
+
+    // only ever replaced by the owning thread, or by writers under lock
+    [[nodiscard]] payload * data() const noexcept {
+        return m_data.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool unique() const noexcept {
+        return data()->count == 1;
+    }
+
+    static void dispose(payload *p) noexcept {
+        if (auto *r = p->reclaim.load(std::memory_order_relaxed)) {
+            r->retire(p);
+        } else {
+            delete p;
+        }
+    }
+
+private:
+    std::atomic<payload *> m_data;
+};
+
+/**
+ * Specializations for thread-safe code path
+ */
+template <typename T>
+const T& cow_read(const T &v) {
+    return v;
+}
+
+template <typename T>
+const T& cow_read(copy_on_write<T> &v) {
+    return v.read();
+}
+
+template <typename T>
+T& cow_write(T &v) {
     return v;
 }
 
@@ -446,6 +1260,105 @@ T& cow_write(copy_on_write<T> &v) {
     return v.write();
 }
 
+template <typename T>
+void cow_set_reclaimer(T &, reclaimer *) {}
+
+template <typename T>
+void cow_set_reclaimer(copy_on_write<T> &v, reclaimer *r) {
+    v.set_reclaimer(r);
+}
+
+/**
+ * A sequence lock, for signals emitted concurrently far more often than they
+ * are modified.
+ *
+ * Writers exclude each other with a mutex, and bump a sequence number before
+ * and after modifying the signal. Emissions take no lock: they copy the handle
+ * over the slot list optimistically, and take it again if the sequence number
+ * moved meanwhile. Slot lists dropped under a seqlock are retired to a shared
+ * reclaimer, and destroyed by writers once the emissions that may still be
+ * copying them are over, so that emitting threads never free them.
+ */
+class seqlock {
+public:
+    seqlock() = default;
+    seqlock(const seqlock &) = delete;
+    seqlock & operator=(const seqlock &) = delete;
+    seqlock(seqlock &&) = delete;
+    seqlock & operator=(seqlock &&) = delete;
+
+    void lock() {
+        m_mutex.lock();
+        m_seq.fetch_add(1);
+    }
+
+    bool try_lock() {
+        if (!m_mutex.try_lock()) {
+            return false;
+        }
+        m_seq.fetch_add(1);
+        return true;
+    }
+
+    void unlock() {
+        m_seq.fetch_add(1, std::memory_order_release);
+        m_mutex.unlock();
+        collect();
+    }
+
+    // the sequence number to check a read against, once no writer runs
+    [[nodiscard]] std::uint64_t read_begin() const noexcept {
+        for (;;) {
+            const auto seq = m_seq.load(std::memory_order_acquire);
+            if ((seq & 1U) == 0) {
+                return seq;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    // whether a writer ran since read_begin() returned seq
+    [[nodiscard]] bool read_retry(std::uint64_t seq) const noexcept {
+        return m_seq.load() != seq;
+    }
+
+    // where the slot lists of seqlock signals get retired
+    static reclaimer & graveyard() {
+        static reclaimer r;
+        return r;
+    }
+
+private:
+    // the emissions copying a retired list run in read-side sections
+    static void collect() {
+        auto &g = graveyard();
+        if (g.empty()) {
+            return;
+        }
+        auto *dropped = g.detach();
+        quiescence_domain::instance().synchronize();
+        reclaimer::destroy(dropped);
+    }
+
+    std::mutex m_mutex;
+    std::atomic<std::uint64_t> m_seq{0};
+};
+
+// lock policies whose emissions share the lock
+template <typename L>
+concept SharedLockable = requires(L &l) {
+    l.lock_shared();
+    l.unlock_shared();
+};
+
+// lock policies whose emissions read optimistically
+template <typename L>
+concept SeqLockable = requires(const L &l, std::uint64_t seq) {
+    { l.read_begin() } -> std::same_as<std::uint64_t>;
+    { l.read_retry(seq) } -> std::same_as<bool>;
+    { L::graveyard() } -> std::same_as<reclaimer &>;
+};
+
 /**
  * std::make_shared instantiates a lot a templates, and makes both compilation time
  * and executable size far bigger than they need to be. We offer a make_shared
@@ -465,6 +1378,71 @@ inline std::shared_ptr<B> make_shared(Arg && ... arg) {
 }
 #endif
 
+class slot_state;
+struct observer_list;
+
+// the signal side of slot states, to remove many slots of a signal at once
+struct slot_owner {
+    virtual ~slot_owner() = default;
+    virtual void clean_all(std::span<slot_state * const> slots) = 0;
+};
+
+// the entry of a slot in the connection list of an observer
+struct observer_link {
+    observer_link *prev = nullptr;
+    observer_link *next = nullptr;
+    bool linked = false;
+    std::weak_ptr<slot_state> slot;
+    std::shared_ptr<observer_list> list;
+};
+
+/*
+ * The connections of an observer, in an intrusive list threaded through the
+ * slots, each of which owns its link and unlinks itself when leaving its
+ * signal. The list is shared with the links, so that it outlives the observer
+ * for as long as the slots need it. It is guarded by a spin lock, only held
+ * for pointer splices.
+ */
+struct observer_list {
+    // bind a slot, before it gets added to its signal
+    static void track(const std::shared_ptr<observer_list> &list,
+                      const std::shared_ptr<slot_state> &s);
+
+    void unlink(observer_link &l) noexcept {
+        std::lock_guard<spin_mutex> _{mutex};
+        if (l.linked) {
+            unlink_locked(l);
+        }
+    }
+
+    // disconnect every slot of the list, removing them signal by signal
+    void disconnect_all();
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        std::lock_guard<spin_mutex> _{mutex};
+        return count;
+    }
+
+    mutable spin_mutex mutex;
+    observer_link *head = nullptr;
+    std::size_t count = 0;
+
+private:
+    void unlink_locked(observer_link &l) noexcept {
+        if (l.prev) {
+            l.prev->next = l.next;
+        } else {
+            head = l.next;
+        }
+        if (l.next) {
+            l.next->prev = l.prev;
+        }
+        l.prev = l.next = nullptr;
+        l.linked = false;
+        --count;
+    }
+};
+
 /* slot_state holds slot type independent state, to be used to interact with
  * slots indirectly through connection and scoped_connection objects.
  */
@@ -473,13 +1451,21 @@ public:
     constexpr slot_state() noexcept
         : m_index(0)
         , m_connected(true)
-        , m_blocked(false)
+        , m_flags(0)
     {}
 
-    virtual ~slot_state() = default;
+    virtual ~slot_state() {
+        unlink_observer();
+    }
+
+    slot_state(const slot_state &) = delete;
+    slot_state & operator=(const slot_state &) = delete;
 
     [[nodiscard]] virtual bool connected() const noexcept { return m_connected; }
 
+    // the signal the slot belongs to, if any
+    [[nodiscard]] virtual slot_owner * owner() const noexcept { return nullptr; }
+
     bool disconnect() noexcept {
         bool ret = m_connected.exchange(false);
         if (ret) {
@@ -488,13 +1474,17 @@ public:
         return ret;
     }
 
-    [[nodiscard]] bool blocked() const noexcept { return m_blocked.load(); }
-    void block()   noexcept { m_blocked.store(true); }
-    void unblock() noexcept { m_blocked.store(false); }
+    [[nodiscard]] bool blocked() const noexcept { return m_flags.load() & blocked_flag; }
+    void block()   noexcept { update_flags(blocked_flag, 0); }
+    void unblock() noexcept { update_flags(0, blocked_flag); }
 
 protected:
     virtual void do_disconnect() {}
 
+    // called whenever the slot starts or stops being active, that is both
+    // listed in a signal and not blocked
+    virtual void activity_changed(bool) noexcept {}
+
     [[nodiscard]] auto index() const {
         return m_index;
     }
@@ -506,10 +1496,152 @@ protected:
 private:
     template <GroupId, typename, typename...>
     friend class ::sigslot::signal_base;
+    friend struct observer_list;
+
+    static constexpr unsigned blocked_flag = 1;
+    static constexpr unsigned listed_flag = 2;
+
+    void set_listed(bool listed) noexcept {
+        if (listed) {
+            update_flags(listed_flag, 0);
+        } else {
+            // an unlisted slot may outlive its signal in a reclaimer, its
+            // connections must not reach the signal anymore
+            m_connected.store(false);
+            update_flags(0, listed_flag);
+            unlink_observer();
+        }
+    }
+
+    void unlink_observer() noexcept {
+        if (m_link) {
+            m_link->list->unlink(*m_link);
+        }
+    }
+
+    // a compare and swap loop makes every activity transition observed once
+    void update_flags(unsigned set, unsigned clear) noexcept {
+        auto old = m_flags.load();
+        unsigned desired = 0;
+        do {
+            desired = (old | set) & ~clear;
+        } while (!m_flags.compare_exchange_weak(old, desired));
+
+        const bool was_active = old == listed_flag;
+        const bool is_active = desired == listed_flag;
+        if (was_active != is_active) {
+            activity_changed(is_active);
+        }
+    }
 
     std::size_t m_index;     // index into the array of slot pointers inside the signal
     std::atomic<bool> m_connected;
-    std::atomic<bool> m_blocked;
+    std::atomic<unsigned> m_flags;
+    std::unique_ptr<observer_link> m_link;  // set for slots bound to an observer
+};
+
+inline void observer_list::track(const std::shared_ptr<observer_list> &list,
+                                 const std::shared_ptr<slot_state> &s) {
+    auto l = std::make_unique<observer_link>();
+    l->slot = s;
+    l->list = list;
+    {
+        std::lock_guard<spin_mutex> _{list->mutex};
+        l->next = list->head;
+        if (list->head) {
+            list->head->prev = l.get();
+        }
+        list->head = l.get();
+        l->linked = true;
+        ++list->count;
+    }
+    s->m_link = std::move(l);
+}
+
+inline void observer_list::disconnect_all() {
+    std::vector<std::shared_ptr<slot_state>> slots;
+    {
+        std::lock_guard<spin_mutex> _{mutex};
+        slots.reserve(count);
+        while (head) {
+            if (auto s = head->slot.lock()) {
+                slots.push_back(std::move(s));
+            }
+            unlink_locked(*head);
+        }
+    }
+
+    // claim the slots not disconnected concurrently
+    std::erase_if(slots, [](const auto &s) { return !s->m_connected.exchange(false); });
+
+    // one lock and one copy of the slot list per signal
+    std::sort(slots.begin(), slots.end(), [](const auto &a, const auto &b) {
+        return std::less<>{}(a->owner(), b->owner());
+    });
+
+    std::vector<slot_state *> batch;
+    for (auto it = slots.begin(); it != slots.end();) {
+        auto *owner = (*it)->owner();
+        batch.clear();
+        for (; it != slots.end() && (*it)->owner() == owner; ++it) {
+            batch.push_back(it->get());
+        }
+        if (owner) {
+            owner->clean_all(batch);
+        }
+    }
+}
+
+/*
+ * The state shared by the slots of a group, and the handles over it. It holds
+ * the blocked flag of the group in bit 0, and the number of its active slots
+ * above it, in units of two, so that blocking a group takes its slots out of
+ * the listener count of the signal at once. The same layout is used by said
+ * listener count, into which changes are propagated while the group is not
+ * blocked.
+ */
+struct group_state {
+    static constexpr std::size_t blocked_bit = 1;
+    static constexpr std::size_t unit = 2;
+
+    [[nodiscard]] bool blocked() const noexcept {
+        return word.load(std::memory_order_relaxed) & blocked_bit;
+    }
+
+    void block() noexcept {
+        const auto old = word.fetch_or(blocked_bit);
+        if (!(old & blocked_bit)) {
+            propagate(false, old);
+        }
+    }
+
+    void unblock() noexcept {
+        const auto old = word.fetch_and(~blocked_bit);
+        if (old & blocked_bit) {
+            propagate(true, old & ~blocked_bit);
+        }
+    }
+
+    void slot_activity(bool active) noexcept {
+        const auto old = active ? word.fetch_add(unit) : word.fetch_sub(unit);
+        if (!(old & blocked_bit)) {
+            propagate(active, unit);
+        }
+    }
+
+    // counts are added modulo, a transiently negative one is harmless
+    void propagate(bool add, std::size_t n) noexcept {
+        if (auto *l = listeners.load(std::memory_order_relaxed)) {
+            if (add) {
+                l->fetch_add(n, std::memory_order_relaxed);
+            } else {
+                l->fetch_sub(n, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::atomic<std::size_t> word{0};
+    std::atomic<std::atomic<std::size_t> *> listeners{nullptr};
 };
 
 template<typename Group>
@@ -519,12 +1651,22 @@ protected:
         : slot_state()
         , m_group(gid)
     {}
+
+    // the state of the group, set before the slot gets listed in the signal
+    [[nodiscard]] group_state & state() const noexcept {
+        return *m_state;
+    }
+
 public:
     [[nodiscard]] Group const& group() const {
         return m_group;
     }
 private:
+    template <GroupId, typename, typename...>
+    friend class ::sigslot::signal_base;
+
     const Group m_group;
+    std::shared_ptr<group_state> m_state;
 };
 
 } // namespace detail
@@ -625,6 +1767,7 @@ public:
 
 protected:
     template <GroupId, typename, typename...> friend class signal_base;
+    template <typename, typename...> friend class rt_signal_base;
     explicit connection(std::weak_ptr<detail::slot_state> s) noexcept
         : m_state{std::move(s)}
     {}
@@ -669,6 +1812,54 @@ private:
     {}
 };
 
+/**
+ * group_handle blocks and unblocks a group of slots of a signal without
+ * locking, for groups toggled often such as debug or optional features.
+ *
+ * A handle obtained from a signal controls the group for the lifetime of the
+ * signal, or until the signal gets cleared. It may outlive both safely.
+ */
+class group_handle {
+public:
+    group_handle() = default;
+
+    /**
+     * Blocks the group
+     * Safety: thread safe, lock-free
+     */
+    void block() const noexcept {
+        if (m_state) {
+            m_state->block();
+        }
+    }
+
+    /**
+     * Unblocks the group
+     * Safety: thread safe, lock-free
+     */
+    void unblock() const noexcept {
+        if (m_state) {
+            m_state->unblock();
+        }
+    }
+
+    [[nodiscard]] bool blocked() const noexcept {
+        return m_state && m_state->blocked();
+    }
+
+    [[nodiscard]] bool valid() const noexcept {
+        return m_state != nullptr;
+    }
+
+private:
+    template <GroupId, typename, typename...> friend class signal_base;
+    explicit group_handle(std::shared_ptr<detail::group_state> s) noexcept
+        : m_state{std::move(s)}
+    {}
+
+    std::shared_ptr<detail::group_state> m_state;
+};
+
 /**
  * Observer is a base class for intrusive lifetime tracking of objects.
  *
@@ -676,10 +1867,21 @@ private:
  * and manual connection management by keeping connection objects in scope.
  * Deriving from this class allows automatic disconnection of all the slots
  * connected to any signal when an instance is destroyed.
+ *
+ * The connections are tracked in an intrusive list threaded through the slots,
+ * which leave it as soon as they are disconnected. The list has a spin lock of
+ * its own, held for pointer splices only, so Lockable is not used anymore and
+ * only kept for compatibility.
  */
 template <typename Lockable>
 struct observer_base : private detail::observer_type {
-    virtual ~observer_base() = default;
+    observer_base() = default;
+    observer_base(const observer_base &) = delete;
+    observer_base & operator=(const observer_base &) = delete;
+
+    virtual ~observer_base() {
+        disconnect_all();
+    }
 
 protected:
     /**
@@ -690,21 +1892,27 @@ protected:
      * destructor. This will ensure proper disconnection prior to the destruction.
      */
     void disconnect_all() {
-        std::unique_lock<Lockable> _{m_mutex};
-        m_connections.clear();
+        m_connections->disconnect_all();
+    }
+
+    /**
+     * Number of slots bound to this object, slots leaving their signal being
+     * forgotten right away.
+     */
+    [[nodiscard]] std::size_t connection_count() const noexcept {
+        return m_connections->size();
     }
 
 private:
     template <GroupId, typename, typename ...>
     friend class signal_base;
 
-    void add_connection(connection conn) {
-        std::unique_lock<Lockable> _{m_mutex};
-        m_connections.emplace_back(std::move(conn));
+    // must be called before the slot gets added to its signal
+    void add_connection(const std::shared_ptr<detail::slot_state> &s) {
+        detail::observer_list::track(m_connections, s);
     }
 
-    Lockable m_mutex;
-    std::vector<scoped_connection> m_connections;
+    std::shared_ptr<detail::observer_list> m_connections = std::make_shared<detail::observer_list>();
 };
 
 /**
@@ -717,6 +1925,57 @@ using observer_st = observer_base<detail::null_mutex>;
  */
 using observer = observer_base<std::mutex>;
 
+/**
+ * Trackable is a base class for cheap intrusive lifetime tracking of objects.
+ *
+ * Slots bound to a pointer to a trackable object check an alive flag owned
+ * by the object before each call, with a single relaxed load, instead of
+ * locking a weak pointer. They get disconnected by the first emission that
+ * finds the object destroyed.
+ *
+ * Safe teardown relies on a quiescence protocol: destroying the object clears
+ * its flag, then waits for the emissions that may be calling its slots from
+ * other threads to complete. Those emissions pay for a read-side section,
+ * a couple of atomic operations per emission rather than per slot, and only
+ * for signals that ever had a trackable slot.
+ *
+ * Destroying a trackable object from a slot does not wait for the emission
+ * of the calling thread. Two threads doing so at the same time from slots
+ * wait for each other, which must be avoided.
+ */
+class trackable : private detail::trackable_type {
+public:
+    trackable() = default;
+    trackable(const trackable &) = delete;
+    trackable & operator=(const trackable &) = delete;
+
+    virtual ~trackable() {
+        expire();
+    }
+
+protected:
+    /**
+     * Mark the object as destroyed and wait for the calls of its slots in
+     * flight to complete.
+     *
+     * To avoid invocation of slots on a semi-destructed instance, which may happen
+     * in multi-threaded contexts, derived classes should call this method in their
+     * destructor. This will ensure that no slot runs anymore prior to the destruction.
+     */
+    void expire() {
+        // no need to wait if no slot ever shared the flag
+        if (m_alive->exchange(false) && m_alive.use_count() > 1) {
+            detail::quiescence_domain::instance().synchronize();
+        }
+    }
+
+private:
+    template <GroupId, typename, typename ...>
+    friend class signal_base;
+
+    std::shared_ptr<std::atomic<bool>> m_alive = std::make_shared<std::atomic<bool>>(true);
+};
+
 
 namespace detail {
 
@@ -737,6 +1996,30 @@ concept ConnectExtendedCallable =
         } -> std::same_as<sigslot::connection>;
     };
 
+template <typename Sig, typename... Args>
+concept ConnectQueuedCallable =
+    requires(Sig sig, Args && ... args) {
+        {
+        sig.connect_queued(std::forward<Args>(args)...)
+        } -> std::same_as<sigslot::connection>;
+    };
+
+template <typename Sig, typename... Args>
+concept ConnectBatchCallable =
+    requires(Sig sig, Args && ... args) {
+        {
+        sig.connect_batch(std::forward<Args>(args)...)
+        } -> std::same_as<sigslot::connection>;
+    };
+
+template <typename Sig, typename... Args>
+concept ConnectAsyncCallable =
+    requires(Sig sig, Args && ... args) {
+        {
+        sig.connect_async(std::forward<Args>(args)...)
+        } -> std::same_as<sigslot::connection>;
+    };
+
 template <typename Sig, typename... Args>
 concept DisconnectCallable =
     requires(Sig sig, Args && ... args) {
@@ -745,11 +2028,73 @@ concept DisconnectCallable =
         } -> std::same_as<size_t>;
     };
 
+// hashing of the bytes of a function pointer
+struct func_ptr_hash {
+    std::size_t operator()(const func_ptr &p) const noexcept {
+        return std::hash<std::string_view>{}(std::string_view(std::begin(p.data), sizeof(p.data)));
+    }
+};
+
+/*
+ * Secondary indexes of the slots of a signal, by callable and by object, so
+ * that disconnecting by callable or object only visits the matching slots.
+ * Slots are indexed by the keys they are compared by on disconnection, and
+ * only when those are set.
+ */
+template <typename Slot>
+struct disconnect_index {
+    using slot_set = std::unordered_set<Slot *>;
+
+    void insert(Slot *s) {
+        if (auto f = s->callable_key()) {
+            by_callable[f].insert(s);
+        }
+        if (auto o = s->object_key()) {
+            by_object[o].insert(s);
+        }
+    }
+
+    void erase(Slot *s) {
+        if (auto f = s->callable_key()) {
+            erase_from(by_callable, f, s);
+        }
+        if (auto o = s->object_key()) {
+            erase_from(by_object, o, s);
+        }
+    }
+
+    // the slots indexed by a key, possibly none
+    template <typename Map, typename Key>
+    static std::vector<Slot *> find(const Map &m, const Key &k) {
+        auto it = m.find(k);
+        if (it == m.end()) {
+            return {};
+        }
+        return {it->second.begin(), it->second.end()};
+    }
+
+    std::unordered_map<func_ptr, slot_set, func_ptr_hash> by_callable;
+    std::unordered_map<obj_ptr, slot_set> by_object;
+
+private:
+    template <typename Map, typename Key>
+    static void erase_from(Map &m, const Key &k, Slot *s) {
+        if (auto it = m.find(k); it != m.end()) {
+            it->second.erase(s);
+            if (it->second.empty()) {
+                m.erase(it);
+            }
+        }
+    }
+};
+
 // interface for cleanable objects, used to cleanup disconnected slots
 template<typename Group>
-struct cleanable {
-    virtual ~cleanable() = default;
+struct cleanable : slot_owner {
     virtual void clean(grouped_slot<Group> *) = 0;
+
+    // whether expired slots found by emissions are left for a later sweep
+    [[nodiscard]] virtual bool defers_expired() const noexcept { return false; }
 };
 
 template <typename Group, typename...>
@@ -758,6 +2103,34 @@ class slot_base;
 template <typename Group, typename... T>
 using slot_ptr = std::shared_ptr<slot_base<Group, T...>>;
 
+/*
+ * Emitted arguments cross the type-erased call_slot boundary as arg_t, which
+ * is a const reference for value types, so that fanning an emission out to
+ * many slots never copies them. Small trivially copyable types are passed by
+ * value, and reference types are passed through unchanged.
+ */
+template <typename T>
+using arg_t = std::conditional_t<std::is_reference_v<T> ||
+                                 (std::is_trivially_copyable_v<T> &&
+                                  sizeof(T) <= 2 * sizeof(void*)),
+                                 T, const T&>;
+
+/*
+ * Invoke a slot callable with arguments received through the call_slot
+ * boundary. The arguments are handed over as is whenever the callable accepts
+ * them, otherwise, for instance for a callable taking a mutable reference to
+ * a value argument, the slot is given its own copy as it used to be.
+ */
+template <typename... Args, typename F, typename... A>
+inline void invoke_slot(F &&f, A &...a) {
+    if constexpr (std::is_invocable_v<F, A&...>) {
+        std::forward<F>(f)(a...);
+    } else {
+        std::tuple<Args...> copy{a...};
+        std::apply(std::forward<F>(f), copy);
+    }
+}
+
 
 /* A base class for slot objects. This base type only depends on slot argument
  * types, it will be used as an element in an intrusive singly-linked list of
@@ -775,7 +2148,14 @@ public:
 
     // method effectively responsible for calling the "slot" function with
     // supplied arguments whenever emission happens.
-    virtual void call_slot(Args...) = 0;
+    virtual void call_slot(arg_t<Args>...) = 0;
+
+    // whether emissions must run in a read-side section of the quiescence
+    // domain for the slot to be called safely, see trackable
+    [[nodiscard]] virtual bool needs_quiescence() const noexcept { return false; }
+
+    // whether the slot tracks an object that has been destroyed
+    [[nodiscard]] virtual bool expired() const noexcept { return false; }
 
     template <typename... U>
     void operator()(U && ...u) {
@@ -784,6 +2164,33 @@ public:
         }
     }
 
+    // start the slot as part of an asynchronous emission, which awaits its
+    // completion through the join. Synchronous slots are simply called.
+    virtual void call_async(async_join &, arg_t<Args> ...args) {
+        call_slot(args...);
+    }
+
+    // process a batch of emissions, one emission at a time unless overridden
+    virtual void call_batch(std::span<const std::tuple<Args...>> batch) {
+        for (const auto &t : batch) {
+            std::apply([this](arg_t<Args> ...a) { call_slot(a...); }, t);
+        }
+    }
+
+    // the slot state is checked once for the whole batch
+    void batch(std::span<const std::tuple<Args...>> b) {
+        if (slot_state::connected() && !slot_state::blocked()) {
+            call_batch(b);
+        }
+    }
+
+    template <typename... U>
+    void start(async_join &join, U && ...u) {
+        if (slot_state::connected() && !slot_state::blocked()) {
+            call_async(join, std::forward<U>(u)...);
+        }
+    }
+
     // check if we are storing callable c
     template <typename C>
     [[nodiscard]] [[nodiscard]] [[nodiscard]] [[nodiscard]] bool has_callable(const C &c) const {
@@ -810,11 +2217,36 @@ public:
         return get_object() == get_object_ptr(o);
     }
 
+    // the keys the slot is found by in the disconnect indexes of the signal
+    [[nodiscard]] func_ptr callable_key() const noexcept {
+        return get_callable();
+    }
+
+    [[nodiscard]] obj_ptr object_key() const noexcept {
+        return get_object();
+    }
+
 protected:
     void do_disconnect() final {
         cleaner.clean(this);
     }
 
+    void activity_changed(bool active) noexcept final {
+        this->state().slot_activity(active);
+    }
+
+    [[nodiscard]] slot_owner * owner() const noexcept final {
+        return &cleaner;
+    }
+
+    // to be called by an emission that finds the tracked object destroyed,
+    // unless the signal leaves the slot to collect_expired()
+    void drop_expired() noexcept {
+        if (!cleaner.defers_expired()) {
+            slot_state::disconnect();
+        }
+    }
+
     // retieve a pointer to the object embedded in the slot
     [[nodiscard]] virtual obj_ptr get_object() const noexcept {
         return nullptr;
@@ -861,8 +2293,57 @@ public:
         , func{std::forward<F>(f)} {}
 
 protected:
-    void call_slot(Args ...args) override {
-        func(args...);
+    void call_slot(arg_t<Args> ...args) override {
+        invoke_slot<Args...>([this](auto &...a) -> decltype(func(a...)) {
+            return func(a...);
+        }, args...);
+    }
+
+    // the whole batch is processed without further virtual calls
+    void call_batch(std::span<const std::tuple<Args...>> batch) override {
+        for (const auto &t : batch) {
+            std::apply([this](arg_t<Args> ...args) {
+                invoke_slot<Args...>([this](auto &...a) -> decltype(func(a...)) {
+                    return func(a...);
+                }, args...);
+            }, t);
+        }
+    }
+
+    [[nodiscard]] func_ptr get_callable() const noexcept override {
+        return get_function_ptr(func);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    [[nodiscard]] const std::type_info& get_callable_type() const noexcept override {
+        return typeid(func);
+    }
+#endif
+
+private:
+    std::decay_t<Func> func;
+};
+
+/*
+ * A slot object whose callable receives whole batches of emissions, as spans
+ * of argument tuples. Single emissions are handed over as one element spans.
+ */
+template <typename Group, typename Func, typename... Args>
+class slot_batch final : public slot_base<Group, Args...> {
+public:
+    template <typename F>
+    constexpr slot_batch(cleanable<Group> &c, F && f, Group const& gid)
+        : slot_base<Group, Args...>(c, gid)
+        , func{std::forward<F>(f)} {}
+
+protected:
+    void call_slot(arg_t<Args> ...args) override {
+        const std::tuple<Args...> t{args...};
+        func(std::span<const std::tuple<Args...>>{&t, 1});
+    }
+
+    void call_batch(std::span<const std::tuple<Args...>> batch) override {
+        func(batch);
     }
 
     [[nodiscard]] func_ptr get_callable() const noexcept override {
@@ -893,8 +2374,10 @@ public:
     connection conn; // TODO(CK): prevent public members!
 
 protected:
-    void call_slot(Args ...args) override {
-        func(conn, args...);
+    void call_slot(arg_t<Args> ...args) override {
+        invoke_slot<Args...>([this](auto &...a) -> decltype(func(conn, a...)) {
+            return func(conn, a...);
+        }, args...);
     }
 
     [[nodiscard]] func_ptr get_callable() const noexcept override {
@@ -926,8 +2409,10 @@ public:
         , ptr{std::forward<P>(p)} {}
 
 protected:
-    void call_slot(Args ...args) override {
-        ((*ptr).*pmf)(args...);
+    void call_slot(arg_t<Args> ...args) override {
+        invoke_slot<Args...>([this](auto &...a) -> decltype(((*ptr).*pmf)(a...)) {
+            return ((*ptr).*pmf)(a...);
+        }, args...);
     }
 
     [[nodiscard]] func_ptr get_callable() const noexcept override {
@@ -964,8 +2449,10 @@ public:
     connection conn; // TODO(CK): prevent public members!
 
 protected:
-    void call_slot(Args ...args) override {
-        ((*ptr).*pmf)(conn, args...);
+    void call_slot(arg_t<Args> ...args) override {
+        invoke_slot<Args...>([this](auto &...a) -> decltype(((*ptr).*pmf)(conn, a...)) {
+            return ((*ptr).*pmf)(conn, a...);
+        }, args...);
     }
 
     [[nodiscard]] func_ptr get_callable() const noexcept override {
@@ -986,6 +2473,84 @@ private:
     std::decay_t<Ptr> ptr;
 };
 
+/*
+ * A slot object that does not invoke its callable on emission, but posts it
+ * to an executor along with a copy of the arguments. Delivery is skipped if
+ * the slot has been disconnected or blocked in the meantime.
+ */
+template <typename Group, typename Func, typename Executor, typename... Args>
+class slot_queued final : public slot_base<Group, Args...> {
+public:
+    template <typename F>
+    constexpr slot_queued(cleanable<Group> &c, F && f, Executor &e, Group const& gid)
+        : slot_base<Group, Args...>(c, gid)
+        , func{std::forward<F>(f)}
+        , exec{&e} {}
+
+    std::weak_ptr<slot_state> self; // TODO(CK): prevent public members!
+
+protected:
+    void call_slot(arg_t<Args> ...args) override {
+        exec->post([this, s = self, packed = std::tuple<std::decay_t<Args>...>{args...}]() mutable {
+            // the slot is kept alive for the duration of the call
+            auto sp = s.lock();
+            if (sp && sp->connected() && !sp->blocked()) {
+                std::apply(func, packed);
+            }
+        });
+    }
+
+    [[nodiscard]] func_ptr get_callable() const noexcept override {
+        return get_function_ptr(func);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    [[nodiscard]] const std::type_info& get_callable_type() const noexcept override {
+        return typeid(func);
+    }
+#endif
+
+private:
+    std::decay_t<Func> func;
+    Executor *exec;
+};
+
+/*
+ * A slot object whose callable is a coroutine returning a task. The task is
+ * launched on emission and runs on its own, or is awaited along the other
+ * slots of an asynchronous emission.
+ */
+template <typename Group, typename Func, typename... Args>
+class slot_async final : public slot_base<Group, Args...> {
+public:
+    template <typename F>
+    constexpr slot_async(cleanable<Group> &c, F && f, Group const& gid)
+        : slot_base<Group, Args...>(c, gid)
+        , func{std::forward<F>(f)} {}
+
+protected:
+    void call_slot(arg_t<Args> ...args) override {
+        launch(func(args...), nullptr);
+    }
+
+    void call_async(async_join &join, arg_t<Args> ...args) override {
+        launch(func(args...), &join);
+    }
+
+    [[nodiscard]] func_ptr get_callable() const noexcept override {
+        return get_function_ptr(func);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    [[nodiscard]] const std::type_info& get_callable_type() const noexcept override {
+        return typeid(func);
+    }
+#endif
+
+private:
+    std::decay_t<Func> func;
+};
+
 /*
  * An implementation of a slot that tracks the life of a supplied object
  * through a weak pointer in order to automatically disconnect the slot
@@ -1005,15 +2570,21 @@ public:
         return !ptr.expired() && slot_state::connected();
     }
 
+    [[nodiscard]] bool expired() const noexcept override {
+        return ptr.expired();
+    }
+
 protected:
-    void call_slot(Args ...args) override {
+    void call_slot(arg_t<Args> ...args) override {
         auto sp = ptr.lock();
         if (!sp) {
-            slot_state::disconnect();
+            this->drop_expired();
             return;
         }
         if (slot_state::connected()) {
-            func(args...);
+            invoke_slot<Args...>([this](auto &...a) -> decltype(func(a...)) {
+                return func(a...);
+            }, args...);
         }
     }
 
@@ -1055,15 +2626,21 @@ public:
         return !ptr.expired() && slot_state::connected();
     }
 
+    [[nodiscard]] bool expired() const noexcept override {
+        return ptr.expired();
+    }
+
 protected:
-    void call_slot(Args ...args) override {
+    void call_slot(arg_t<Args> ...args) override {
         auto sp = ptr.lock();
         if (!sp) {
-            slot_state::disconnect();
+            this->drop_expired();
             return;
         }
         if (slot_state::connected()) {
-            ((*sp).*pmf)(args...);
+            invoke_slot<Args...>([this, &sp](auto &...a) -> decltype(((*sp).*pmf)(a...)) {
+                return ((*sp).*pmf)(a...);
+            }, args...);
         }
     }
 
@@ -1086,6 +2663,126 @@ private:
     std::decay_t<WeakPtr> ptr;
 };
 
+using alive_ptr = std::shared_ptr<const std::atomic<bool>>;
+
+/*
+ * An implementation of a slot that tracks the life of a supplied trackable
+ * object through its alive flag, in order to automatically disconnect the
+ * slot on said object destruction.
+ */
+template <typename Group, typename Func, typename Ptr, typename... Args>
+class slot_trackable final : public slot_base<Group, Args...> {
+public:
+    template <typename F, typename P>
+    constexpr slot_trackable(cleanable<Group> &c, F && f, P && p, alive_ptr a, Group const& gid)
+        : slot_base<Group, Args...>(c, gid)
+        , func{std::forward<F>(f)}
+        , ptr{std::forward<P>(p)}
+        , alive{std::move(a)}
+    {}
+
+    [[nodiscard]] bool connected() const noexcept override {
+        return alive->load(std::memory_order_relaxed) && slot_state::connected();
+    }
+
+    [[nodiscard]] bool needs_quiescence() const noexcept override {
+        return true;
+    }
+
+    [[nodiscard]] bool expired() const noexcept override {
+        return !alive->load(std::memory_order_relaxed);
+    }
+
+protected:
+    void call_slot(arg_t<Args> ...args) override {
+        if (!alive->load(std::memory_order_relaxed)) {
+            this->drop_expired();
+            return;
+        }
+        invoke_slot<Args...>([this](auto &...a) -> decltype(func(a...)) {
+            return func(a...);
+        }, args...);
+    }
+
+    [[nodiscard]] func_ptr get_callable() const noexcept override {
+        return get_function_ptr(func);
+    }
+
+    [[nodiscard]] obj_ptr get_object() const noexcept override {
+        return get_object_ptr(ptr);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    [[nodiscard]] const std::type_info& get_callable_type() const noexcept override {
+        return typeid(func);
+    }
+#endif
+
+private:
+    std::decay_t<Func> func;
+    std::decay_t<Ptr> ptr;
+    alive_ptr alive;
+};
+
+/*
+ * An implementation of a slot as a pointer over member function, that tracks
+ * the life of a supplied trackable object through its alive flag in order to
+ * automatically disconnect the slot on said object destruction.
+ */
+template <typename Group, typename Pmf, typename Ptr, typename... Args>
+class slot_pmf_trackable final : public slot_base<Group, Args...> {
+public:
+    template <typename F, typename P>
+    constexpr slot_pmf_trackable(cleanable<Group> &c, F && f, P && p, alive_ptr a, Group const& gid)
+        : slot_base<Group, Args...>(c, gid)
+        , pmf{std::forward<F>(f)}
+        , ptr{std::forward<P>(p)}
+        , alive{std::move(a)}
+    {}
+
+    [[nodiscard]] bool connected() const noexcept override {
+        return alive->load(std::memory_order_relaxed) && slot_state::connected();
+    }
+
+    [[nodiscard]] bool needs_quiescence() const noexcept override {
+        return true;
+    }
+
+    [[nodiscard]] bool expired() const noexcept override {
+        return !alive->load(std::memory_order_relaxed);
+    }
+
+protected:
+    void call_slot(arg_t<Args> ...args) override {
+        if (!alive->load(std::memory_order_relaxed)) {
+            this->drop_expired();
+            return;
+        }
+        invoke_slot<Args...>([this](auto &...a) -> decltype(((*ptr).*pmf)(a...)) {
+            return ((*ptr).*pmf)(a...);
+        }, args...);
+    }
+
+    [[nodiscard]] func_ptr get_callable() const noexcept override {
+        return get_function_ptr(pmf);
+    }
+
+    [[nodiscard]] obj_ptr get_object() const noexcept override {
+        return get_object_ptr(ptr);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    [[nodiscard]] const std::type_info& get_callable_type() const noexcept override {
+        return typeid(pmf);
+    }
+#endif
+
+private:
+    std::decay_t<Pmf> pmf;
+    std::decay_t<Ptr> ptr;
+    alive_ptr alive;
+};
+
 } // namespace detail
 
 
@@ -1128,14 +2825,261 @@ private:
     using slot_base = detail::slot_base<group_id, T...>;
     using slot_ptr = detail::slot_ptr<Group, T...>;
     using slots_type = std::vector<slot_ptr>;
-    struct group_type { slots_type slts; group_id gid; };
+    using index_type = detail::disconnect_index<slot_base>;
+    using group_state_ptr = std::shared_ptr<detail::group_state>;
+    // the disconnection keys of the slots are packed next to them, at the
+    // same indices, to be compared without calling into the slots
+    struct group_type {
+        slots_type slts;
+        group_id gid;
+        group_state_ptr state;
+        std::vector<detail::func_ptr> callables{};
+        std::vector<detail::obj_ptr> objects{};
+    };
     using list_type = std::vector<group_type>;  // kept ordered by ascending gid
 
+    static constexpr std::size_t blocked_bit = detail::group_state::blocked_bit;
+    static constexpr std::size_t listener_unit = detail::group_state::unit;
+
 public:
+    /**
+     * The awaitable returned by next(). It links itself into an intrusive
+     * list of the signal on suspension, so that awaiting allocates nothing.
+     */
+    class next_awaiter {
+    public:
+        explicit next_awaiter(signal_base &sig) noexcept
+            : m_sig{&sig}
+        {}
+
+        next_awaiter(const next_awaiter &) = delete;
+        next_awaiter & operator=(const next_awaiter &) = delete;
+        next_awaiter(next_awaiter &&) = delete;
+        next_awaiter & operator=(next_awaiter &&) = delete;
+
+        ~next_awaiter() {
+            // a coroutine destroyed while suspended must leave the list
+            if (!m_value && m_sig) {
+                m_sig->unlink_awaiter(this);
+            }
+        }
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> h) {
+            m_handle = h;
+            m_sig->link_awaiter(this);
+        }
+
+        std::tuple<std::decay_t<T>...> await_resume() {
+            return std::move(*m_value);
+        }
+
+    private:
+        friend class signal_base;
+
+        signal_base *m_sig;
+        next_awaiter *m_prev = nullptr;
+        next_awaiter *m_next = nullptr;
+        bool m_linked = false;
+        std::coroutine_handle<> m_handle;
+        std::optional<std::tuple<std::decay_t<T>...>> m_value;
+    };
+
+    /**
+     * A stream buffers the emissions of a signal in a fixed size ring, for a
+     * coroutine to consume them at its own pace. It is obtained from stream(),
+     * and stays attached to the signal until closed or destroyed.
+     */
+    class event_stream {
+    public:
+        using value_type = std::tuple<std::decay_t<T>...>;
+
+        class awaiter {
+        public:
+            explicit awaiter(event_stream &s) noexcept
+                : m_stream{&s}
+            {}
+
+            [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+            bool await_suspend(std::coroutine_handle<> h) {
+                lock_type lock(m_stream->m_mutex);
+                if (m_stream->m_count > 0 || m_stream->m_closed) {
+                    return false;
+                }
+                m_stream->m_waiter = h;
+                return true;
+            }
+
+            std::optional<value_type> await_resume() {
+                return m_stream->try_next();
+            }
+
+        private:
+            event_stream *m_stream;
+        };
+
+        event_stream(signal_base &sig, std::size_t capacity, ConflationPolicy policy)
+            : m_ring(policy == ConflationPolicy::KEEP_LATEST ? 1 : std::max<std::size_t>(capacity, 1))
+            , m_policy{policy}
+        {
+            sig.link_stream(this);
+        }
+
+        event_stream(const event_stream &) = delete;
+        event_stream & operator=(const event_stream &) = delete;
+        event_stream(event_stream &&) = delete;
+        event_stream & operator=(event_stream &&) = delete;
+
+        ~event_stream() {
+            close();
+        }
 
-    signal_base() noexcept : m_block(false) {}
+        /**
+         * Await the next buffered emission
+         *
+         * Effect: Suspends the awaiting coroutine until an emission is
+         *         available, unless one is buffered already.
+         * Safety: A stream supports a single consumer.
+         *
+         * @return an awaitable yielding the emitted arguments as a tuple, or
+         *         nothing once the stream has been closed and drained
+         */
+        [[nodiscard]] awaiter next() noexcept {
+            return awaiter{*this};
+        }
+
+        /**
+         * Take the oldest buffered emission, if any, without waiting
+         */
+        std::optional<value_type> try_next() {
+            lock_type lock(m_mutex);
+            if (m_count == 0) {
+                return std::nullopt;
+            }
+
+            auto &slot = m_ring[m_head];
+            std::optional<value_type> v{std::move(*slot)};
+            slot.reset();
+            m_head = (m_head + 1) % m_ring.size();
+            --m_count;
+            return v;
+        }
+
+        /**
+         * Detach the stream from the signal
+         *
+         * Buffered emissions can still be consumed, after which a suspended
+         * consumer is resumed with an empty value.
+         */
+        void close() {
+            if (auto *sig = m_sig.load(std::memory_order_acquire)) {
+                sig->unlink_stream(this);
+            }
+
+            std::coroutine_handle<> h;
+            {
+                lock_type lock(m_mutex);
+                m_closed = true;
+                h = std::exchange(m_waiter, nullptr);
+            }
+            if (h) {
+                h.resume();
+            }
+        }
+
+        [[nodiscard]] bool closed() const {
+            lock_type lock(m_mutex);
+            return m_closed;
+        }
+
+        /**
+         * Number of buffered emissions
+         */
+        [[nodiscard]] std::size_t size() const {
+            lock_type lock(m_mutex);
+            return m_count;
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept {
+            return m_ring.size();
+        }
+
+        /**
+         * Number of emissions dropped, or conflated, because the consumer did
+         * not keep up
+         */
+        [[nodiscard]] std::size_t overflow_count() const noexcept {
+            return m_overflow.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] ConflationPolicy policy() const noexcept {
+            return m_policy;
+        }
+
+    private:
+        friend class signal_base;
+
+        // buffer an emission, returns the consumer to resume if it waits
+        template <typename... A>
+        std::coroutine_handle<> push(A & ...a) {
+            lock_type lock(m_mutex);
+            if (m_closed) {
+                return nullptr;
+            }
+
+            if (m_count == m_ring.size()) {
+                m_ring[m_head].reset();
+                m_head = (m_head + 1) % m_ring.size();
+                --m_count;
+                m_overflow.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            m_ring[(m_head + m_count) % m_ring.size()].emplace(a...);
+            ++m_count;
+            return std::exchange(m_waiter, nullptr);
+        }
+
+        std::vector<std::optional<value_type>> m_ring;
+        std::size_t m_head = 0;
+        std::size_t m_count = 0;
+        std::atomic<std::size_t> m_overflow{0};
+        ConflationPolicy m_policy;
+        bool m_closed = false;
+        std::coroutine_handle<> m_waiter;
+        mutable Lockable m_mutex;
+
+        // links in the signal, guarded by the signal mutex
+        std::atomic<signal_base *> m_sig{nullptr};
+        event_stream *m_prev = nullptr;
+        event_stream *m_next = nullptr;
+        event_stream *m_ready = nullptr;
+        std::coroutine_handle<> m_resume;
+    };
+
+    signal_base() noexcept : m_listeners(0) {}
     ~signal_base() override {
         disconnect_all();
+
+        // awaiting coroutines are left suspended, they must be destroyed,
+        // while streams are closed
+        event_stream *streams = nullptr;
+        {
+            lock_type lock(m_mutex);
+            for (auto *w = m_awaiters_head; w; w = w->m_next) {
+                w->m_linked = false;
+                w->m_sig = nullptr;
+            }
+            streams = std::exchange(m_streams, nullptr);
+            for (auto *s = streams; s; s = s->m_next) {
+                s->m_sig.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        while (streams) {
+            std::exchange(streams, streams->m_next)->close();
+        }
     }
 
     signal_base(const signal_base&) = delete;
@@ -1143,10 +3087,18 @@ public:
 
     // NOLINTNEXTLINE(hicpp-noexcept-move,performance-noexcept-move-constructor)
     signal_base(signal_base && o) /* not noexcept */
-        : m_block{o.m_block.load()}
     {
         lock_type lock(o.m_mutex);
-        std::swap(m_slots, o.m_slots);
+        // never leaves a null list for an optimistic emission to copy
+        using std::swap;
+        swap(m_slots, o.m_slots);
+        adopt_groups(&m_listeners);
+        m_slot_count.store(o.m_slot_count.exchange(0));
+        m_quiescent.store(o.m_quiescent.exchange(false));
+        m_defer_expired.store(o.m_defer_expired.exchange(false));
+        std::swap(m_index, o.m_index);
+        m_listeners.store(o.m_listeners.exchange(o.m_listeners.load() & blocked_bit));
+        swap_watchers(o);
     }
 
     // NOLINTNEXTLINE(hicpp-noexcept-move,performance-noexcept-move-constructor)
@@ -1155,8 +3107,16 @@ public:
         lock_type lock2(o.m_mutex, std::defer_lock);
         std::lock(lock1, lock2);
 
-        std::swap(m_slots, o.m_slots);
-        m_block.store(o.m_block.exchange(m_block.load()));
+        using std::swap;
+        swap(m_slots, o.m_slots);
+        adopt_groups(&m_listeners);
+        o.adopt_groups(&o.m_listeners);
+        swap_watchers(o);
+        m_slot_count.store(o.m_slot_count.exchange(m_slot_count.load()));
+        m_quiescent.store(o.m_quiescent.exchange(m_quiescent.load()));
+        m_defer_expired.store(o.m_defer_expired.exchange(m_defer_expired.load()));
+        std::swap(m_index, o.m_index);
+        m_listeners.store(o.m_listeners.exchange(m_listeners.load()));
         return *this;
     }
 
@@ -1170,23 +3130,222 @@ public:
      *         signal object, it does not cover thread safety of potentially
      *         shared state used in slot functions.
      *
+     * Arguments are converted to the signal argument types once, and handed
+     * to every slot by reference: no copy is made per slot unless a slot
+     * callable requires one, by taking a mutable reference to a value argument.
+     *
      * @param a... arguments to emit
      */
     template <typename... U>
     void operator()(U && ...a) {
-        if (m_block) {
+        if (!has_listeners()) {
             return;
         }
 
-        // Reference to the slots to execute them out of the lock
-        // a copy may occur if another thread writes to it.
-        cow_copy_type<list_type> ref = slots_reference();
+        emit(std::forward<U>(a)...);
+    }
 
-        for (const auto &group : detail::cow_read(ref)) {
-            for (const auto &s : group.slts) {
-                s->operator()(a...);
+    /**
+     * Emit a signal to the slots of a single group
+     *
+     * Effect: All non blocked and connected slot functions of the group will
+     *         be called with supplied arguments. Other groups are not visited,
+     *         and neither are awaiting coroutines and streams.
+     * Safety: Same as operator().
+     *
+     * @param gid the group to emit to
+     * @param a... arguments to emit
+     */
+    template <typename... U>
+    void emit_group(group_id const& gid, U && ...a) {
+        if (!has_listeners()) {
+            return;
+        }
+
+        emit_between(gid, [&](group_id const& g) { return !(gid < g); },
+                     std::forward<U>(a)...);
+    }
+
+    /**
+     * Emit a signal to the slots of the groups in the range [lo, hi)
+     *
+     * Effect: All non blocked and connected slot functions of the groups
+     *         whose id lies in the range will be called with supplied
+     *         arguments, in group order. Awaiting coroutines and streams are
+     *         not notified.
+     * Safety: Same as operator().
+     *
+     * @param lo the first group of the range
+     * @param hi the end of the range, excluded
+     * @param a... arguments to emit
+     */
+    template <typename... U>
+    void emit_range(group_id const& lo, group_id const& hi, U && ...a) {
+        if (!has_listeners()) {
+            return;
+        }
+
+        emit_between(lo, [&](group_id const& g) { return g < hi; },
+                     std::forward<U>(a)...);
+    }
+
+    /**
+     * Emit a signal, running the slots of each group concurrently
+     *
+     * Effect: All non blocked and connected slot functions will be called
+     *         with supplied arguments. The slots of a group are run in
+     *         parallel on the pool, whose completion is awaited before moving
+     *         on to the next group, thus preserving group ordering.
+     * Safety: Same as operator(). The arguments are shared by concurrently
+     *         running slots, which must not modify them.
+     *
+     * @param pool a parallel executor, such as sigslot::work_stealing_pool
+     * @param a... arguments to emit
+     */
+    template <trait::ParallelExecutor Pool, typename... U>
+    void emit_parallel(Pool &pool, U && ...a) {
+        if (!has_listeners()) {
+            return;
+        }
+
+        emit_on(pool, std::forward<U>(a)...);
+    }
+
+    /**
+     * Emit a signal with arguments computed only if someone listens
+     *
+     * Effect: Calls the producer and emits the tuple it returns, only if
+     *         has_listeners() is true. The producer is not called otherwise.
+     * Safety: Same as operator().
+     *
+     * @param producer a callable returning a tuple of arguments to emit
+     */
+    template <typename Producer>
+    requires std::invocable<Producer&>
+    void emit_lazy(Producer && producer) {
+        if (!has_listeners()) {
+            return;
+        }
+
+        std::apply([this](auto && ...a) {
+            emit(std::forward<decltype(a)>(a)...);
+        }, producer());
+    }
+
+    /**
+     * Emit a signal once for each element of a batch of argument tuples
+     *
+     * Effect: Equivalent to emitting every tuple of the batch in order, but
+     *         the slots are iterated over once: each slot processes the whole
+     *         batch before the next one runs, and slots connected through
+     *         connect_batch() receive it at once.
+     * Safety: Same as operator(). The blocked and connected states of a slot
+     *         are checked once per batch, so that a slot blocked or
+     *         disconnected while processing a batch still receives all of it.
+     *
+     * @param batch a span of argument tuples
+     */
+    void emit_batch(std::span<const std::tuple<T...>> batch) {
+        if (!has_listeners() || batch.empty()) {
+            return;
+        }
+
+        {
+            cow_copy_type<list_type> ref = slots_reference();
+            detail::read_section section{m_quiescent.load(std::memory_order_relaxed)};
+            for (const auto &group : detail::cow_read(ref)) {
+                if (group.state->blocked()) {
+                    continue;
+                }
+                for (const auto &s : group.slts) {
+                    s->batch(batch);
+                }
+            }
+        }
+
+        if (m_watching.load(std::memory_order_relaxed) > 0) {
+            for (const auto &t : batch) {
+                std::apply([this](detail::arg_t<T> ...a) { notify_watchers(a...); }, t);
+            }
+        }
+    }
+
+    /**
+     * Emit a signal asynchronously
+     *
+     * Effect: Returns a lazy task which, once awaited, starts all the non
+     *         blocked and connected slots in group order, asynchronous slots
+     *         running concurrently, and completes when all of them have.
+     * Safety: Same as operator(). The signal must outlive the task.
+     *
+     * The arguments are stored in the task, so that slots may keep
+     * references to them until they complete. The first exception thrown
+     * by an asynchronous slot is rethrown to the awaiter.
+     *
+     * @param a... arguments to emit
+     * @return a task to be awaited
+     */
+    task<> emit_async(T... a) {
+        if (!has_listeners()) {
+            co_return;
+        }
+
+        detail::async_join join;
+        {
+            cow_copy_type<list_type> ref = slots_reference();
+            detail::read_section section{m_quiescent.load(std::memory_order_relaxed)};
+            for (const auto &group : detail::cow_read(ref)) {
+                if (group.state->blocked()) {
+                    continue;
+                }
+                for (const auto &s : group.slts) {
+                    s->start(join, a...);
+                }
             }
         }
+
+        notify_watchers(a...);
+        co_await join;
+    }
+
+    /**
+     * Await the next emission of the signal
+     *
+     * Effect: Suspends the awaiting coroutine until the next time the signal
+     *         is emitted, after its slots have been called, and yields a
+     *         tuple holding a copy of the emitted arguments.
+     * Safety: Thread-safety depends on locking policy. The coroutine is
+     *         resumed from the emitting thread.
+     *
+     * Awaiting does not allocate. A coroutine still waiting when the signal
+     * is destroyed is never resumed.
+     *
+     * @return an awaitable yielding a std::tuple of the emitted arguments
+     */
+    [[nodiscard]] next_awaiter next() noexcept {
+        return next_awaiter{*this};
+    }
+
+    /**
+     * Attach a stream buffering the emissions of the signal
+     *
+     * Effect: Every subsequent emission is copied into the stream ring
+     *         buffer, after the slots have been called, until the stream is
+     *         closed or destroyed. The stream must not outlive the signal
+     *         unless closed.
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * Emission only pays for streams when some are attached. A full stream
+     * drops its oldest emission, and KEEP_LATEST streams only keep the latest
+     * one. Dropped emissions are accounted for by overflow_count().
+     *
+     * @param capacity the number of emissions the stream can hold
+     * @param policy the conflation policy
+     * @return the stream
+     */
+    [[nodiscard]] event_stream stream(std::size_t capacity,
+                                      ConflationPolicy policy = ConflationPolicy::KEEP_ALL) {
+        return event_stream{*this, capacity, policy};
     }
 
     /**
@@ -1231,6 +3390,82 @@ public:
         return conn;
     }
 
+    /**
+     * Connect a callable to be invoked asynchronously through an executor
+     *
+     * Effect: Emission does not call the callable, but posts a task holding
+     *         a copy of the arguments to the executor, which invokes it later
+     *         unless the connection has been blocked or disconnected meanwhile.
+     * Safety: Thread-safety depends on locking policy. The executor must
+     *         outlive the connection.
+     *
+     * Tasks are posted in slot group order, which is kept as long as the
+     * executor runs tasks in the order they were posted, as do event loops
+     * and single threaded pools.
+     *
+     * @param c a callable
+     * @param e an executor
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Callable, trait::Executor Executor>
+    requires trait::Callable<Callable, std::decay_t<T>...>
+    connection connect_queued(Callable && c, Executor &e, group_id gid = group_id{}) {
+        using slot_t = detail::slot_queued<group_id, Callable, Executor, T...>;
+        auto s = make_slot<slot_t>(std::forward<Callable>(c), e, gid);
+        connection conn(s);
+        std::static_pointer_cast<slot_t>(s)->self = s;
+        add_slot(std::move(s));
+        return conn;
+    }
+
+    /**
+     * Connect a callable processing batches of emissions
+     *
+     * Effect: The callable receives the emissions of emit_batch() all at
+     *         once, as a span of argument tuples. A regular emission is
+     *         handed over as a single element span.
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * @param c a callable taking a std::span<const std::tuple<T...>>
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Callable>
+    requires trait::BatchCallable<Callable, T...>
+    connection connect_batch(Callable && c, group_id gid = group_id{}) {
+        using slot_t = detail::slot_batch<group_id, Callable, T...>;
+        auto s = make_slot<slot_t>(std::forward<Callable>(c), gid);
+        connection conn(s);
+        add_slot(std::move(s));
+        return conn;
+    }
+
+    /**
+     * Connect a coroutine returning a task
+     *
+     * Effect: Emission launches the task, which runs on its own after its
+     *         first suspension. emit_async() awaits its completion instead.
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * Note: as for any coroutine, references received as arguments, as well
+     * as lambda captures, may dangle once the task has been suspended, unless
+     * the task is awaited through emit_async().
+     *
+     * @param c a callable returning a sigslot::task
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Callable>
+    requires trait::AsyncCallable<Callable, detail::arg_t<T>...>
+    connection connect_async(Callable && c, group_id gid = group_id{}) {
+        using slot_t = detail::slot_async<group_id, Callable, T...>;
+        auto s = make_slot<slot_t>(std::forward<Callable>(c), gid);
+        connection conn(s);
+        add_slot(std::move(s));
+        return conn;
+    }
+
     /**
      * Overload of connect for pointers over member functions derived from
      * observer
@@ -1246,8 +3481,8 @@ public:
         using slot_t = detail::slot_pmf<group_id, Pmf, Ptr, T...>;
         auto s = make_slot<slot_t>(std::forward<Pmf>(pmf), std::forward<Ptr>(ptr), gid);
         connection conn(s);
+        ptr->add_connection(s);
         add_slot(std::move(s));
-        ptr->add_connection(conn);
         return conn;
     }
 
@@ -1261,7 +3496,7 @@ public:
      */
     template <typename Pmf, typename Ptr>
     requires trait::MemberCallable<Pmf, Ptr, T...> &&
-            (!trait::Observer<Ptr> && !trait::WeakPtrCompatible<Ptr>)
+            (!trait::Observer<Ptr> && !trait::WeakPtrCompatible<Ptr> && !trait::TrackablePtr<Ptr>)
     connection connect(Pmf && pmf, Ptr && ptr, group_id gid = group_id{}) {
         using slot_t = detail::slot_pmf<group_id, Pmf, Ptr, T...>;
         auto s = make_slot<slot_t>(std::forward<Pmf>(pmf), std::forward<Ptr>(ptr), gid);
@@ -1348,6 +3583,49 @@ public:
         return conn;
     }
 
+    /**
+     * Overload of connect for lifetime tracking of trackable objects and
+     * automatic disconnection
+     *
+     * The object must derive from sigslot::trackable. Its alive flag gets
+     * checked with a relaxed load before each call, see trackable.
+     *
+     * @param pmf a pointer over member function
+     * @param ptr a pointer to a trackable object
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Pmf, trait::TrackablePtr Ptr>
+    requires trait::MemberCallable<Pmf, Ptr, T...> && (!trait::Observer<Ptr>)
+    connection connect(Pmf && pmf, Ptr && ptr, group_id gid = group_id{}) {
+        using slot_t = detail::slot_pmf_trackable<group_id, Pmf, Ptr, T...>;
+        auto a = ptr->trackable::m_alive;
+        auto s = make_slot<slot_t>(std::forward<Pmf>(pmf), std::forward<Ptr>(ptr), std::move(a), gid);
+        connection conn(s);
+        add_slot(std::move(s));
+        return conn;
+    }
+
+    /**
+     * Overload of connect for lifetime tracking of trackable objects and
+     * automatic disconnection
+     *
+     * @param c a callable
+     * @param ptr a pointer to a trackable object
+     * @param gid an identifier that can be used to order slot execution
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename Callable, trait::TrackablePtr Ptr>
+    requires trait::Callable<Callable, T...>
+    connection connect(Callable && c, Ptr && ptr, group_id gid = group_id{}) {
+        using slot_t = detail::slot_trackable<group_id, Callable, Ptr, T...>;
+        auto a = ptr->trackable::m_alive;
+        auto s = make_slot<slot_t>(std::forward<Callable>(c), std::forward<Ptr>(ptr), std::move(a), gid);
+        connection conn(s);
+        add_slot(std::move(s));
+        return conn;
+    }
+
     /**
      * Creates a connection whose duration is tied to the return object
      * Use the same semantics as connect
@@ -1377,9 +3655,15 @@ public:
               trait::MemFnPointer<Callable>)
     && detail::function_traits<Callable>::is_disconnectable
     size_t disconnect(const Callable &c) {
-        return disconnect_if([&] (const auto &s) {
+        auto cond = [&] (const auto &s) {
             return s->has_full_callable(c);
-        });
+        };
+        const auto key = detail::get_function_ptr(c);
+        lock_type lock(m_mutex);
+        if (m_index) {
+            return disconnect_indexed(index_type::find(m_index->by_callable, key), cond);
+        }
+        return disconnect_keyed(&group_type::callables, key, cond);
     }
 
     /**
@@ -1399,9 +3683,19 @@ public:
               !trait::Callable<Obj, connection&, T...> &&
               !trait::MemFnPointer<Obj>)
     size_t disconnect(const Obj &obj) {
-        return disconnect_if([&] (const auto &s) {
+        auto cond = [&] (const auto &s) {
             return s->has_object(obj);
-        });
+        };
+        const auto key = detail::get_object_ptr(obj);
+        lock_type lock(m_mutex);
+        if (!key) {
+            // slots without an object, or whose tracked object expired
+            return disconnect_if(cond);
+        }
+        if (m_index) {
+            return disconnect_indexed(index_type::find(m_index->by_object, key), cond);
+        }
+        return disconnect_keyed(&group_type::objects, key, cond);
     }
 
     /**
@@ -1419,9 +3713,45 @@ public:
      */
     template <typename Callable, typename Obj>
     size_t disconnect(const Callable &c, const Obj &obj) {
-        return disconnect_if([&] (const auto &s) {
+        auto cond = [&] (const auto &s) {
             return s->has_object(obj) && s->has_callable(c);
-        });
+        };
+        const auto key = detail::get_object_ptr(obj);
+        lock_type lock(m_mutex);
+        if (!key) {
+            return disconnect_if(cond);
+        }
+        if (m_index) {
+            return disconnect_indexed(index_type::find(m_index->by_object, key), cond);
+        }
+        return disconnect_keyed(&group_type::objects, key, cond);
+    }
+
+    /**
+     * Index the slots by callable and by object for disconnection
+     *
+     * Effect: Makes disconnect() by callable, object or both only visit the
+     *         slots matching them, instead of every slot of the signal, at
+     *         the expense of memory and of slower connection and removal.
+     *         Already connected slots are indexed right away.
+     * Safety: Thread-safety depends on locking policy.
+     */
+    void enable_disconnect_index() {
+        lock_type lock(m_mutex);
+        if (m_index) {
+            return;
+        }
+        m_index = std::make_unique<index_type>();
+        for (const auto &group : detail::cow_read(m_slots)) {
+            for (const auto &s : group.slts) {
+                m_index->insert(s.get());
+            }
+        }
+    }
+
+    [[nodiscard]] bool disconnect_index_enabled() {
+        lock_type lock(m_mutex);
+        return m_index != nullptr;
     }
 
     /**
@@ -1438,7 +3768,14 @@ public:
         for (auto &group : detail::cow_write(m_slots)) {
             if (group.gid == gid) {
                 size_t count = group.slts.size();
+                for (auto &s : group.slts) {
+                    s->set_listed(false);
+                    unindex(s.get());
+                }
                 group.slts.clear();
+                group.callables.clear();
+                group.objects.clear();
+                m_slot_count.fetch_sub(count, std::memory_order_relaxed);
                 return count;
             }
         }
@@ -1454,26 +3791,93 @@ public:
         clear();
     }
 
+    /**
+     * Remove the slots whose tracked object has been destroyed
+     *
+     * Effect: Disconnects up to max slots tracking a dead object, be it
+     *         through a weak pointer or as a trackable, without calling
+     *         them. Nothing gets written if no slot expired.
+     * Safety: Thread-safety depends on locking policy. The lock is held for
+     *         a scan of the slots and at most one copy of the slot list, so
+     *         that a small max bounds the time emitters may wait for it.
+     *
+     * @param max the maximum number of slots to remove
+     * @return the number of removed slots
+     */
+    size_t collect_expired(size_t max = std::numeric_limits<size_t>::max()) {
+        lock_type lock(m_mutex);
+        std::vector<std::pair<size_t, size_t>> found;  // group and slot indices
+        const auto &groups = detail::cow_read(m_slots);
+        for (size_t g = 0; g < groups.size() && found.size() < max; ++g) {
+            const auto &slts = groups[g].slts;
+            for (size_t i = 0; i < slts.size() && found.size() < max; ++i) {
+                if (slts[i]->expired()) {
+                    found.emplace_back(g, i);
+                }
+            }
+        }
+        return remove_found(found);
+    }
+
+    /**
+     * Leave expired slots to collect_expired()
+     *
+     * Effect: When enabled, an emission that comes across a slot whose tracked
+     *         object has been destroyed skips it rather than removing it,
+     *         which would take the lock and copy the slot list on the
+     *         emitting thread. See also sigslot::reaper.
+     * Safety: thread safe
+     */
+    void defer_expired_cleanup(bool defer = true) noexcept {
+        m_defer_expired.store(defer, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool defers_expired() const noexcept override {
+        return m_defer_expired.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Defer the destruction of dropped slots to a reclaimer
+     *
+     * Effect: The slot lists dropped by the signal, along with the slots and
+     *         captured state they were the last owners of, are retired to the
+     *         reclaimer instead of being destroyed by the thread that drops
+     *         them, which may be emitting. They get destroyed by the next
+     *         reclaimer::reclaim(). As emissions hold on to the list they go
+     *         through, a slot removed while one is running always ends up
+     *         there, so that emitting threads do not free memory. A null
+     *         reclaimer restores immediate destruction.
+     * Safety: Thread-safety depends on locking policy. The reclaimer must
+     *         outlive the signal. Only signals with a thread-safe lock policy
+     *         share slot lists with their emissions, single-threaded ones
+     *         ignore the reclaimer. Signals locking a seqlock have their own.
+     *
+     * @param r a reclaimer, or null
+     */
+    void set_reclaimer(reclaimer *r) requires (!detail::SeqLockable<Lockable>) {
+        lock_type lock(m_mutex);
+        detail::cow_set_reclaimer(m_slots, r);
+    }
+
     /**
      * Blocks signal emission
      * Safety: thread safe
      */
     void block() noexcept {
-        m_block.store(true);
+        m_listeners.fetch_or(blocked_bit);
     }
 
     /**
      * Blocks all slots in a given group
-     * Safety: thread safe
+     *
+     * Effect: Slots of the group are skipped by emission until the group is
+     *         unblocked, without altering the blocking state of each slot.
+     *         Does nothing if the group has no slots yet.
+     * Safety: thread safe, see also group() for lock-free control
      */
     void block(group_id const& gid) {
-        lock_type lock(m_mutex);
-        for (auto &group : detail::cow_write(m_slots)) {
-            if(group.gid == gid) {
-                for (auto& slt : group.slts) {
-                    slt->block();
-                }
-            }
+        if (auto st = find_group_state(gid)) {
+            st->block();
         }
     }
 
@@ -1482,42 +3886,94 @@ public:
      * Safety: thread safe
      */
     void unblock() noexcept {
-        m_block.store(false);
+        m_listeners.fetch_and(~blocked_bit);
     }
 
     /**
      * Unblocks all slots in a given group
-     * Safety: thread safe
+     * Safety: thread safe, see also group() for lock-free control
      */
     void unblock(group_id const& gid) {
+        if (auto st = find_group_state(gid)) {
+            st->unblock();
+        }
+    }
+
+    /**
+     * Tests blocking state of a group
+     * Safety: thread safe
+     */
+    [[nodiscard]] bool blocked(group_id const& gid) {
+        auto st = find_group_state(gid);
+        return st && st->blocked();
+    }
+
+    /**
+     * Get a handle to block and unblock a group without locking
+     *
+     * Effect: Creates the group if it does not exist yet, so that slots
+     *         connected to it later on obey the handle too.
+     * Safety: thread safe
+     *
+     * @param gid a group id
+     * @return a group handle
+     */
+    [[nodiscard]] group_handle group(group_id const& gid) {
         lock_type lock(m_mutex);
-        for (auto &group : detail::cow_write(m_slots)) {
-            if(group.gid == gid) {
-                for (auto& slt : group.slts) {
-                    slt->unblock();
-                }
-            }
+        auto &groups = detail::cow_write(m_slots);
+        auto it = group_lower_bound(groups, gid);
+        if (it == groups.end() || it->gid != gid) {
+            it = groups.insert(it, {{}, gid, make_group_state()});
         }
+        return group_handle{it->state};
     }
 
     /**
      * Tests blocking state of signal emission
      */
     [[nodiscard]] bool blocked() const noexcept {
-        return m_block.load();
+        return m_listeners.load() & blocked_bit;
+    }
+
+    /**
+     * Tests whether an emission would run any slot or wake any awaiting
+     * coroutine or stream
+     *
+     * Effect: A single relaxed atomic load, meant to skip the preparation of
+     *         arguments nobody would receive. Returns false if the signal is
+     *         blocked, or if there are no unblocked slots and no watchers.
+     * Safety: thread safe. The answer may be stale by the time it is used,
+     *         and slots whose tracked object expired count until removed.
+     */
+    [[nodiscard]] bool has_listeners() const noexcept {
+        const auto v = m_listeners.load(std::memory_order_relaxed);
+        return (v & blocked_bit) == 0 && v != 0;
     }
 
     /**
      * Get number of connected slots
+     * Safety: thread safe, a single atomic load
+     */
+    [[nodiscard]] size_t slot_count() const noexcept {
+        return m_slot_count.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Get the contention met by the lock of the signal, for lock policies
+     * that keep count of it, such as detail::counted_adaptive_mutex
      * Safety: thread safe
      */
-    size_t slot_count() noexcept {
-        cow_copy_type<list_type> ref = slots_reference();
-        size_t count = 0;
-        for (const auto &g : detail::cow_read(ref)) {
-            count += g.slts.size();
-        }
-        return count;
+    [[nodiscard]] detail::lock_stats lock_stats() const noexcept
+    requires requires(const Lockable &l) { { l.stats() } -> std::same_as<detail::lock_stats>; } {
+        return m_mutex.stats();
+    }
+
+    /**
+     * Tests whether no slot is connected
+     * Safety: thread safe, a single atomic load
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return slot_count() == 0;
     }
 
 protected:
@@ -1536,9 +3992,8 @@ protected:
 
                 // ensure we have the right slot, in case of concurrent cleaning
                 if (idx < slts.size() && slts[idx] && slts[idx].get() == state) {
-                    std::swap(slts[idx], slts.back());
-                    slts[idx]->index() = idx;
-                    slts.pop_back();
+                    remove_slot(group, idx);
+                    m_slot_count.fetch_sub(1, std::memory_order_relaxed);
                 }
 
                 return;
@@ -1546,11 +4001,273 @@ protected:
         }
     }
 
+    // remove many slots already marked as disconnected with a single lock
+    // and at most one copy of the slot list
+    void clean_all(std::span<detail::slot_state * const> states) override {
+        lock_type lock(m_mutex);
+        auto &groups = detail::cow_write(m_slots);
+        size_t count = 0;
+
+        for (auto *st : states) {
+            auto *state = static_cast<detail::grouped_slot<Group> *>(st);
+            auto it = group_lower_bound(groups, state->group());
+            if (it == groups.end() || it->gid != state->group()) {
+                continue;
+            }
+
+            const auto idx = state->index();
+            if (idx < it->slts.size() && it->slts[idx].get() == state) {
+                remove_slot(*it, idx);
+                ++count;
+            }
+        }
+
+        m_slot_count.fetch_sub(count, std::memory_order_relaxed);
+    }
+
 private:
+    // call every slot, the arguments having been converted once by the caller
+    void emit(detail::arg_t<T>... a) {
+        // Reference to the slots to execute them out of the lock
+        // a copy may occur if another thread writes to it.
+        cow_copy_type<list_type> ref = slots_reference();
+        // read after the reference, so that a trackable slot found in it
+        // is never called outside of a read-side section
+        detail::read_section section{m_quiescent.load(std::memory_order_relaxed)};
+
+        for (const auto &group : detail::cow_read(ref)) {
+            if (group.state->blocked()) {
+                continue;
+            }
+            for (const auto &s : group.slts) {
+                s->operator()(a...);
+            }
+        }
+
+        notify_watchers(a...);
+    }
+
+    // call the slots of the groups from lo, found by binary search, as long
+    // as their id satisfies the predicate
+    template <typename InRange>
+    void emit_between(group_id const& lo, InRange in_range, detail::arg_t<T>... a) {
+        cow_copy_type<list_type> ref = slots_reference();
+        detail::read_section section{m_quiescent.load(std::memory_order_relaxed)};
+        const auto &groups = detail::cow_read(ref);
+
+        for (auto it = group_lower_bound(groups, lo); it != groups.end() && in_range(it->gid); ++it) {
+            if (it->state->blocked()) {
+                continue;
+            }
+            for (const auto &s : it->slts) {
+                s->operator()(a...);
+            }
+        }
+    }
+
+    // call the slots of each group concurrently on a pool
+    template <typename Pool>
+    void emit_on(Pool &pool, detail::arg_t<T>... a) {
+        cow_copy_type<list_type> ref = slots_reference();
+        detail::read_section section{m_quiescent.load(std::memory_order_relaxed)};
+
+        for (const auto &group : detail::cow_read(ref)) {
+            const auto &slts = group.slts;
+            if (group.state->blocked()) {
+                continue;
+            }
+            if (slts.size() == 1) {
+                slts.front()->operator()(a...);
+            } else if (!slts.empty()) {
+                pool.parallel_for(slts.size(), [&](std::size_t i) {
+                    slts[i]->operator()(a...);
+                });
+            }
+        }
+
+        notify_watchers(a...);
+    }
+
+    // feed the streams and resume the coroutines awaiting an emission, the
+    // latter out of the lock
+    void notify_watchers(detail::arg_t<T>... a) {
+        if (m_watching.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+
+        next_awaiter *w = nullptr;
+        event_stream *ready = nullptr;
+        {
+            lock_type lock(m_mutex);
+            w = std::exchange(m_awaiters_head, nullptr);
+            m_awaiters_tail = nullptr;
+            for (auto *n = w; n; n = n->m_next) {
+                n->m_linked = false;
+                m_watching.fetch_sub(1, std::memory_order_relaxed);
+                m_listeners.fetch_sub(listener_unit, std::memory_order_relaxed);
+            }
+
+            for (auto *st = m_streams; st; st = st->m_next) {
+                if (auto h = st->push(a...)) {
+                    st->m_resume = h;
+                    st->m_ready = ready;
+                    ready = st;
+                }
+            }
+        }
+
+        // a resumed coroutine may destroy its awaiter or stream, or await again
+        while (ready) {
+            auto *st = std::exchange(ready, ready->m_ready);
+            st->m_resume.resume();
+        }
+
+        while (w) {
+            auto *n = std::exchange(w, w->m_next);
+            n->m_value.emplace(a...);
+            n->m_handle.resume();
+        }
+    }
+
+    void link_awaiter(next_awaiter *w) {
+        lock_type lock(m_mutex);
+        w->m_prev = m_awaiters_tail;
+        w->m_next = nullptr;
+        w->m_linked = true;
+        if (m_awaiters_tail) {
+            m_awaiters_tail->m_next = w;
+        } else {
+            m_awaiters_head = w;
+        }
+        m_awaiters_tail = w;
+        m_watching.fetch_add(1, std::memory_order_relaxed);
+        m_listeners.fetch_add(listener_unit, std::memory_order_relaxed);
+    }
+
+    void unlink_awaiter(next_awaiter *w) {
+        lock_type lock(m_mutex);
+        if (!w->m_linked) {
+            return;
+        }
+
+        (w->m_prev ? w->m_prev->m_next : m_awaiters_head) = w->m_next;
+        (w->m_next ? w->m_next->m_prev : m_awaiters_tail) = w->m_prev;
+        w->m_linked = false;
+        m_watching.fetch_sub(1, std::memory_order_relaxed);
+        m_listeners.fetch_sub(listener_unit, std::memory_order_relaxed);
+    }
+
+    void link_stream(event_stream *st) {
+        lock_type lock(m_mutex);
+        st->m_sig.store(this, std::memory_order_relaxed);
+        st->m_prev = nullptr;
+        st->m_next = m_streams;
+        if (m_streams) {
+            m_streams->m_prev = st;
+        }
+        m_streams = st;
+        m_watching.fetch_add(1, std::memory_order_relaxed);
+        m_listeners.fetch_add(listener_unit, std::memory_order_relaxed);
+    }
+
+    void unlink_stream(event_stream *st) {
+        lock_type lock(m_mutex);
+        if (st->m_sig.load(std::memory_order_relaxed) != this) {
+            return;
+        }
+
+        (st->m_prev ? st->m_prev->m_next : m_streams) = st->m_next;
+        if (st->m_next) {
+            st->m_next->m_prev = st->m_prev;
+        }
+        st->m_sig.store(nullptr, std::memory_order_relaxed);
+        m_watching.fetch_sub(1, std::memory_order_relaxed);
+        m_listeners.fetch_sub(listener_unit, std::memory_order_relaxed);
+    }
+
+    // exchange awaiters and streams with another signal, both being locked
+    void swap_watchers(signal_base &o) noexcept {
+        std::swap(m_awaiters_head, o.m_awaiters_head);
+        std::swap(m_awaiters_tail, o.m_awaiters_tail);
+        std::swap(m_streams, o.m_streams);
+        m_watching.store(o.m_watching.exchange(m_watching.load()));
+        for (auto *w = m_awaiters_head; w; w = w->m_next) {
+            w->m_sig = this;
+        }
+        for (auto *w = o.m_awaiters_head; w; w = w->m_next) {
+            w->m_sig = &o;
+        }
+        for (auto *st = m_streams; st; st = st->m_next) {
+            st->m_sig.store(this, std::memory_order_relaxed);
+        }
+        for (auto *st = o.m_streams; st; st = st->m_next) {
+            st->m_sig.store(&o, std::memory_order_relaxed);
+        }
+    }
+
     // used to get a reference to the slots for reading
     inline cow_copy_type<list_type> slots_reference() {
+        if constexpr (detail::SeqLockable<Lockable>) {
+            return optimistic_slots_reference();
+        } else if constexpr (detail::SharedLockable<Lockable>) {
+            std::shared_lock<Lockable> lock(m_mutex);
+            return m_slots;
+        } else {
+            lock_type lock(m_mutex);
+            return m_slots;
+        }
+    }
+
+    // the handle gets copied without locking, in a read-side section which
+    // keeps writers from destroying the list meanwhile, and copied again if
+    // a writer ran in between, as it may have modified the list in place
+    cow_copy_type<list_type> optimistic_slots_reference() {
+        detail::read_section section{true};
+        for (;;) {
+            const auto seq = m_mutex.read_begin();
+            auto ref = m_slots.try_copy();
+            if (ref && !m_mutex.read_retry(seq)) {
+                return std::move(*ref);
+            }
+        }
+    }
+
+    static cow_type<list_type> make_slot_list() {
+        cow_type<list_type> slots;
+        if constexpr (detail::SeqLockable<Lockable>) {
+            detail::cow_set_reclaimer(slots, &Lockable::graveyard());
+        }
+        return slots;
+    }
+
+    group_state_ptr make_group_state() {
+        auto st = std::make_shared<detail::group_state>();
+        st->listeners.store(&m_listeners, std::memory_order_relaxed);
+        return st;
+    }
+
+    template <typename List>
+    static auto group_lower_bound(List &groups, group_id const& gid) {
+        return std::lower_bound(groups.begin(), groups.end(), gid,
+                                [](const group_type &g, group_id const& id) { return g.gid < id; });
+    }
+
+    // find the state of a group, the list being kept sorted by group id
+    group_state_ptr find_group_state(group_id const& gid) {
         lock_type lock(m_mutex);
-        return m_slots;
+        const auto &groups = detail::cow_read(m_slots);
+        auto it = group_lower_bound(groups, gid);
+        if (it == groups.end() || it->gid != gid) {
+            return nullptr;
+        }
+        return it->state;
+    }
+
+    // point the group states at the listener count of their signal
+    void adopt_groups(std::atomic<std::size_t> *listeners) {
+        for (const auto &group : detail::cow_read(m_slots)) {
+            group.state->listeners.store(listeners, std::memory_order_relaxed);
+        }
     }
 
     // create a new slot
@@ -1567,25 +4284,32 @@ private:
         auto &groups = detail::cow_write(m_slots);
 
         // find the group
-        auto it = groups.begin();
-        while (it != groups.end() && it->gid < gid) {
-            it++;
-        }
+        auto it = group_lower_bound(groups, gid);
 
         // create a new group if necessary
         if (it == groups.end() || it->gid != gid) {
-            it = groups.insert(it, {{}, gid});
+            it = groups.insert(it, {{}, gid, make_group_state()});
         }
 
         // add the slot
+        s->m_state = it->state;
         s->index() = it->slts.size();
+        it->callables.push_back(s->callable_key());
+        it->objects.push_back(s->object_key());
+        if (s->needs_quiescence()) {
+            m_quiescent.store(true, std::memory_order_relaxed);
+        }
         it->slts.push_back(std::move(s));
+        it->slts.back()->set_listed(true);
+        if (m_index) {
+            m_index->insert(it->slts.back().get());
+        }
+        m_slot_count.fetch_add(1, std::memory_order_relaxed);
     }
 
-    // disconnect a slot if a condition occurs
+    // to be called under lock: disconnect a slot if a condition occurs
     template <typename Cond>
     size_t disconnect_if(Cond && cond) {
-        lock_type lock(m_mutex);
         auto &groups = detail::cow_write(m_slots);
 
         size_t count = 0;
@@ -1595,9 +4319,7 @@ private:
             size_t i = 0;
             while (i < slts.size()) {
                 if (cond(slts[i])) {
-                    std::swap(slts[i], slts.back());
-                    slts[i]->index() = i;
-                    slts.pop_back();
+                    remove_slot(group, i);
                     ++count;
                 } else {
                     ++i;
@@ -1605,18 +4327,130 @@ private:
             }
         }
 
+        m_slot_count.fetch_sub(count, std::memory_order_relaxed);
         return count;
     }
 
+    // to be called under lock: disconnect the candidates found in an index
+    // if a condition occurs, locating each of them by group and index
+    template <typename Cond>
+    size_t disconnect_indexed(const std::vector<slot_base *> &candidates, Cond && cond) {
+        if (candidates.empty()) {
+            return 0;
+        }
+
+        auto &groups = detail::cow_write(m_slots);
+        size_t count = 0;
+
+        for (auto *s : candidates) {
+            if (!cond(s)) {
+                continue;
+            }
+            auto it = group_lower_bound(groups, s->group());
+            remove_slot(*it, s->index());
+            ++count;
+        }
+
+        m_slot_count.fetch_sub(count, std::memory_order_relaxed);
+        return count;
+    }
+
+    // to be called under lock: disconnect the slots whose packed key, among
+    // the given keys of each group, is equal to k if a condition occurs.
+    // Nothing gets written if no slot matches.
+    template <typename Keys, typename Key, typename Cond>
+    size_t disconnect_keyed(Keys group_type::*keys, const Key &k, Cond && cond) {
+        std::vector<std::pair<size_t, size_t>> found;  // group and slot indices
+        {
+            const auto &groups = detail::cow_read(m_slots);
+            for (size_t g = 0; g < groups.size(); ++g) {
+                const auto &group = groups[g];
+                const auto &ks = group.*keys;
+                detail::find_keys(ks.data(), ks.size(), k, [&](size_t i) {
+                    if (cond(group.slts[i])) {
+                        found.emplace_back(g, i);
+                    }
+                });
+            }
+        }
+
+        return remove_found(found);
+    }
+
+    // to be called under lock: remove the slots found at the given group and
+    // slot indices, in increasing order
+    size_t remove_found(const std::vector<std::pair<size_t, size_t>> &found) {
+        if (found.empty()) {
+            return 0;
+        }
+
+        // swapping with the last slot, removing from the end keeps the
+        // indices of the slots yet to be removed valid
+        auto &groups = detail::cow_write(m_slots);
+        for (auto it = found.rbegin(); it != found.rend(); ++it) {
+            remove_slot(groups[it->first], it->second);
+        }
+
+        m_slot_count.fetch_sub(found.size(), std::memory_order_relaxed);
+        return found.size();
+    }
+
+    // to be called under lock: remove the slot at index i of a group
+    void remove_slot(group_type &group, size_t i) {
+        auto &slts = group.slts;
+        slts[i]->set_listed(false);
+        unindex(slts[i].get());
+        std::swap(slts[i], slts.back());
+        slts[i]->index() = i;
+        slts.pop_back();
+        group.callables[i] = group.callables.back();
+        group.callables.pop_back();
+        group.objects[i] = group.objects.back();
+        group.objects.pop_back();
+    }
+
+    void unindex(slot_base *s) {
+        if (m_index) {
+            m_index->erase(s);
+        }
+    }
+
     // to be called under lock: remove all the slots
     void clear() {
-        detail::cow_write(m_slots).clear();
+        auto &groups = detail::cow_write(m_slots);
+        for (auto &group : groups) {
+            for (auto &s : group.slts) {
+                s->set_listed(false);
+            }
+            // outstanding group handles must not reach the signal anymore
+            group.state->listeners.store(nullptr, std::memory_order_relaxed);
+        }
+        groups.clear();
+        if (m_index) {
+            m_index->by_callable.clear();
+            m_index->by_object.clear();
+        }
+        m_slot_count.store(0, std::memory_order_relaxed);
+        m_quiescent.store(false, std::memory_order_relaxed);
     }
 
 private:
     Lockable m_mutex;
-    cow_type<list_type> m_slots;
-    std::atomic<bool> m_block;
+    cow_type<list_type> m_slots{make_slot_list()};
+    // bit 0 tells whether emission is blocked, the other bits count the
+    // active slots and the watchers, in units of listener_unit so that a
+    // transiently negative count never spills over the blocked bit
+    std::atomic<std::size_t> m_listeners;
+    std::atomic<std::size_t> m_slot_count{0};
+    // set once a trackable slot got connected, emissions then running in a
+    // read-side section of the quiescence domain
+    std::atomic<bool> m_quiescent{false};
+    std::atomic<bool> m_defer_expired{false};  // see defer_expired_cleanup()
+    std::unique_ptr<index_type> m_index;  // optional, see enable_disconnect_index()
+    next_awaiter *m_awaiters_head = nullptr;
+    next_awaiter *m_awaiters_tail = nullptr;
+    event_stream *m_streams = nullptr;
+    std::atomic<std::size_t> m_watching{0};  // awaiters and streams
 };
 
 /**
@@ -1638,10 +4472,44 @@ class signal_interface final {
         (*m_sig)(std::forward<U>(args)...);
         }
 
-    inline size_t slot_count() noexcept {
+    template <typename... U>
+    inline void emit_group(Group const& gid, U&& ... args) {
+        m_sig->emit_group(gid, std::forward<U>(args)...);
+    }
+
+    template <typename... U>
+    inline void emit_range(Group const& lo, Group const& hi, U&& ... args) {
+        m_sig->emit_range(lo, hi, std::forward<U>(args)...);
+    }
+
+    template <typename Pool, typename... U>
+    inline void emit_parallel(Pool &pool, U&& ... args) {
+        m_sig->emit_parallel(pool, std::forward<U>(args)...);
+    }
+
+    template <typename B>
+    inline void emit_batch(B&& batch) {
+        m_sig->emit_batch(std::forward<B>(batch));
+    }
+
+    template <typename P>
+    inline void emit_lazy(P&& producer) {
+        m_sig->emit_lazy(std::forward<P>(producer));
+    }
+
+    template <typename... U>
+    inline task<> emit_async(U&& ... args) {
+        return m_sig->emit_async(std::forward<U>(args)...);
+    }
+
+    [[nodiscard]] inline size_t slot_count() const noexcept {
         return m_sig->slot_count();
         }
 
+    [[nodiscard]] inline bool empty() const noexcept {
+        return m_sig->empty();
+        }
+
     inline void block() noexcept {
         m_sig->block();
         }
@@ -1654,6 +4522,14 @@ class signal_interface final {
         m_sig->unblock(gid);
     }
 
+    [[nodiscard]] inline bool blocked(Group const& gid) {
+        return m_sig->blocked(gid);
+    }
+
+    [[nodiscard]] inline group_handle group(Group const& gid) {
+        return m_sig->group(gid);
+    }
+
     inline void unblock() noexcept {
         m_sig->unblock();
         }
@@ -1662,6 +4538,10 @@ class signal_interface final {
         return m_sig->blocked();
         }
 
+    [[nodiscard]] inline bool has_listeners() const noexcept {
+        return m_sig->has_listeners();
+        }
+
     // NOLINTNEXTLINE(hicpp-noexcept-move,performance-noexcept-move-constructor)
     signal_interface(signal_interface&& o) /* not noexcept */ {
         if(o.m_sig_storage.has_value()) {
@@ -1720,6 +4600,33 @@ public:
         return m_sig->connect_extended(std::forward<Ts>(args)...);
         }
 
+    template <typename... Ts>
+    requires detail::ConnectQueuedCallable<signal_type, Ts...>
+    inline connection connect_queued(Ts&& ... args) {
+        return m_sig->connect_queued(std::forward<Ts>(args)...);
+        }
+
+    template <typename... Ts>
+    requires detail::ConnectBatchCallable<signal_type, Ts...>
+    inline connection connect_batch(Ts&& ... args) {
+        return m_sig->connect_batch(std::forward<Ts>(args)...);
+        }
+
+    template <typename... Ts>
+    requires detail::ConnectAsyncCallable<signal_type, Ts...>
+    inline connection connect_async(Ts&& ... args) {
+        return m_sig->connect_async(std::forward<Ts>(args)...);
+        }
+
+    [[nodiscard]] inline auto next() noexcept {
+        return m_sig->next();
+        }
+
+    template <typename... Ts>
+    [[nodiscard]] inline auto stream(Ts&& ... args) {
+        return m_sig->stream(std::forward<Ts>(args)...);
+        }
+
     template <typename... Ts>
     requires detail::ConnectCallable<signal_type, Ts...>
     inline scoped_connection connect_scoped(Ts&& ... args) {
@@ -1761,6 +4668,23 @@ using signal = signal_base<int32_t, std::mutex, T...>;
 template<GroupId Group, typename... T>
 using signal_g = signal_base<int32_t, std::mutex, T...>;
 
+/**
+ * Specialization of signal_base for signals emitted concurrently far more
+ * often than modified. Emissions share a reader-writer lock, which slot
+ * connection and disconnection take exclusively.
+ */
+template <typename... T>
+using signal_rw = signal_base<int32_t, std::shared_mutex, T...>;
+
+/**
+ * Specialization of signal_base whose emissions take no lock at all: they
+ * read the slot list optimistically under a sequence lock, and retry when a
+ * writer ran concurrently. Writers wait for the emissions in progress before
+ * destroying dropped slot lists, see detail::seqlock.
+ */
+template <typename... T>
+using signal_seq = signal_base<int32_t, detail::seqlock, T...>;
+
 /**
  * @brief Specialization of signal_interface for single threaded signals.
  *
@@ -0,0 +1,112 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace sigslot {
+
+/**
+ * A simple thread pool executor, to be used with queued connections.
+ *
+ * Tasks are run in the order they were posted. With a single worker thread,
+ * which is the default, they also complete in that order, which preserves
+ * slot group ordering for queued slots sharing the pool.
+ *
+ * Pending tasks are run before the pool destruction completes.
+ */
+class thread_pool {
+public:
+    explicit thread_pool(std::size_t threads = 1) {
+        if (threads == 0) {
+            threads = 1;
+        }
+
+        m_workers.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            m_workers.emplace_back([this] { run(); });
+        }
+    }
+
+    thread_pool(const thread_pool &) = delete;
+    thread_pool & operator=(const thread_pool &) = delete;
+    thread_pool(thread_pool &&) = delete;
+    thread_pool & operator=(thread_pool &&) = delete;
+
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> _{m_mutex};
+            m_stop = true;
+        }
+        m_cv.notify_all();
+
+        for (auto &w : m_workers) {
+            w.join();
+        }
+    }
+
+    /**
+     * Schedule a task for execution on one of the worker threads
+     * Safety: thread safe
+     */
+    template <typename F>
+    void post(F && f) {
+        {
+            std::lock_guard<std::mutex> _{m_mutex};
+            m_tasks.emplace_back(std::forward<F>(f));
+        }
+        m_cv.notify_one();
+    }
+
+    /**
+     * Wait until every task posted so far has been run
+     * Safety: thread safe, must not be called from a worker thread
+     */
+    void wait_idle() {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_idle_cv.wait(lock, [this] { return m_tasks.empty() && m_running == 0; });
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return m_workers.size();
+    }
+
+private:
+    void run() {
+        std::unique_lock<std::mutex> lock{m_mutex};
+
+        while (true) {
+            m_cv.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+            if (m_tasks.empty()) {
+                return;
+            }
+
+            auto task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+            ++m_running;
+
+            lock.unlock();
+            task();
+            task = nullptr;
+            lock.lock();
+
+            if (--m_running == 0 && m_tasks.empty()) {
+                m_idle_cv.notify_all();
+            }
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::condition_variable m_idle_cv;
+    std::deque<std::function<void()>> m_tasks;
+    std::vector<std::thread> m_workers;
+    std::size_t m_running = 0;
+    bool m_stop = false;
+};
+
+} // namespace sigslot
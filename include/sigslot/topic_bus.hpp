@@ -0,0 +1,303 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <sigslot/signal.hpp>
+
+namespace sigslot {
+
+namespace detail {
+
+// hashing of strings usable for lookups by string_view
+struct string_hash {
+    using is_transparent = void;
+    std::size_t operator()(std::string_view s) const noexcept {
+        return std::hash<std::string_view>{}(s);
+    }
+};
+
+template <typename V>
+using string_map = std::unordered_map<std::string, V, string_hash, std::equal_to<>>;
+
+// calls f on each segment of a dot separated topic or pattern
+template <typename F>
+void for_each_segment(std::string_view s, F &&f) {
+    for (;;) {
+        const auto dot = s.find('.');
+        f(s.substr(0, dot));
+        if (dot == std::string_view::npos) {
+            return;
+        }
+        s.remove_prefix(dot + 1);
+    }
+}
+
+} // namespace detail
+
+/**
+ * topic_bus_base dispatches emissions for hierarchical topics, made of dot
+ * separated segments such as "orders.eu.filled", to the slots connected to
+ * matching patterns. In a pattern, "*" matches exactly one segment, and "#"
+ * matches any number of segments, including none: "orders.*.filled" matches
+ * the topic above, and so does "orders.#".
+ *
+ * Patterns are compiled into a trie when connecting, each pattern owning a
+ * signal shared by its slots. The signals matching a topic are resolved once
+ * and kept in a bounded cache, so that emitting again for a topic costs a
+ * hash lookup. Connecting to a new pattern, or dropping one, empties the
+ * cache, while connecting to an existing pattern leaves it untouched.
+ *
+ * @tparam Lockable a lock type to decide the lock policy
+ * @tparam T... the argument types of the emitting and slots functions
+ */
+template <typename Lockable, typename... T>
+class topic_bus_base {
+    using lock_type = std::unique_lock<Lockable>;
+
+public:
+    using signal_type = signal_base<int32_t, Lockable, T...>;
+
+    static constexpr std::size_t default_cache_capacity = 4096;
+
+    /**
+     * @param cache_capacity the number of resolved topics to remember, the
+     *        cache being emptied when full
+     */
+    explicit topic_bus_base(std::size_t cache_capacity = default_cache_capacity)
+        : m_cache_capacity{cache_capacity}
+    {}
+
+    topic_bus_base(const topic_bus_base &) = delete;
+    topic_bus_base & operator=(const topic_bus_base &) = delete;
+
+    ~topic_bus_base() {
+        disconnect_all();
+    }
+
+    /**
+     * Connect a callable to the topics matching a pattern
+     *
+     * Takes the same arguments as signal_base::connect() after the pattern.
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * @param pattern a dot separated pattern, with "*" and "#" wildcards
+     * @return a connection object that can be used to interact with the slot
+     */
+    template <typename... A>
+    requires requires(signal_type &s, A && ...a) { s.connect(std::forward<A>(a)...); }
+    connection connect(std::string_view pattern, A && ...a) {
+        lock_type lock(m_mutex);
+        return pattern_signal(pattern).connect(std::forward<A>(a)...);
+    }
+
+    /**
+     * Connect a callable taking a connection reference to a pattern
+     * Safety: Thread-safety depends on locking policy.
+     */
+    template <typename... A>
+    requires requires(signal_type &s, A && ...a) { s.connect_extended(std::forward<A>(a)...); }
+    connection connect_extended(std::string_view pattern, A && ...a) {
+        lock_type lock(m_mutex);
+        return pattern_signal(pattern).connect_extended(std::forward<A>(a)...);
+    }
+
+    /**
+     * Emit for a topic
+     *
+     * Effect: The slots of every pattern matching the topic are called with
+     *         supplied arguments, pattern by pattern. A slot is called once
+     *         even though its pattern matches the topic in several ways.
+     * Safety: With proper locking, emission can happen from multiple threads
+     *         simultaneously. The lock is held during the resolution of the
+     *         topic only.
+     *
+     * @param topic a dot separated topic, without wildcards
+     * @param a... arguments to emit
+     */
+    template <typename... U>
+    void emit(std::string_view topic, U && ...a) {
+        const auto sigs = resolve(topic);
+        for (const auto &sig : *sigs) {
+            (*sig)(a...);
+        }
+    }
+
+    /**
+     * Disconnect the slots of a pattern and drop it
+     * Safety: Thread-safety depends on locking policy.
+     *
+     * @return the number of disconnected slots
+     */
+    std::size_t disconnect(std::string_view pattern) {
+        std::shared_ptr<signal_type> sig;
+        {
+            lock_type lock(m_mutex);
+            std::vector<std::pair<node *, std::string_view>> path;
+            node *n = &m_root;
+            detail::for_each_segment(pattern, [&](std::string_view seg) {
+                if (n) {
+                    auto it = n->children.find(seg);
+                    path.emplace_back(n, seg);
+                    n = it == n->children.end() ? nullptr : it->second.get();
+                }
+            });
+            if (!n || !n->sig) {
+                return 0;
+            }
+            sig = std::move(n->sig);
+            --m_pattern_count;
+            m_cache.clear();
+
+            // prune the branch of the pattern up to the first node in use
+            while (!path.empty() && !n->sig && n->children.empty()) {
+                auto [parent, seg] = path.back();
+                path.pop_back();
+                parent->children.erase(parent->children.find(seg));
+                n = parent;
+            }
+        }
+
+        const auto count = sig->slot_count();
+        sig->disconnect_all();
+        return count;
+    }
+
+    /**
+     * Disconnect all the slots and drop every pattern
+     * Safety: Thread-safety depends on locking policy.
+     */
+    void disconnect_all() {
+        node root;
+        {
+            lock_type lock(m_mutex);
+            std::swap(root.children, m_root.children);
+            std::swap(root.sig, m_root.sig);
+            m_pattern_count = 0;
+            m_cache.clear();
+        }
+        disconnect_tree(root);
+    }
+
+    [[nodiscard]] std::size_t pattern_count() const {
+        lock_type lock(m_mutex);
+        return m_pattern_count;
+    }
+
+    /**
+     * Number of topics whose resolution is cached
+     */
+    [[nodiscard]] std::size_t cache_size() const {
+        lock_type lock(m_mutex);
+        return m_cache.size();
+    }
+
+private:
+    using signal_ptr = std::shared_ptr<signal_type>;
+    using signal_list = std::vector<signal_ptr>;
+
+    struct node {
+        detail::string_map<std::unique_ptr<node>> children;
+        signal_ptr sig;
+    };
+
+    // find or create the signal of a pattern
+    signal_type & pattern_signal(std::string_view pattern) {
+        node *n = &m_root;
+        detail::for_each_segment(pattern, [&](std::string_view seg) {
+            auto it = n->children.find(seg);
+            if (it == n->children.end()) {
+                it = n->children.emplace(std::string(seg), std::make_unique<node>()).first;
+            }
+            n = it->second.get();
+        });
+
+        if (!n->sig) {
+            n->sig = std::make_shared<signal_type>();
+            ++m_pattern_count;
+            m_cache.clear();
+        }
+        return *n->sig;
+    }
+
+    // the signals matching a topic, from the cache or by walking the trie
+    std::shared_ptr<const signal_list> resolve(std::string_view topic) {
+        lock_type lock(m_mutex);
+        if (auto it = m_cache.find(topic); it != m_cache.end()) {
+            return it->second;
+        }
+
+        m_segments.clear();
+        detail::for_each_segment(topic, [&](std::string_view seg) {
+            m_segments.push_back(seg);
+        });
+
+        auto sigs = std::make_shared<signal_list>();
+        match(m_root, 0, *sigs);
+
+        if (m_cache_capacity > 0) {
+            if (m_cache.size() >= m_cache_capacity) {
+                m_cache.clear();
+            }
+            m_cache.emplace(std::string(topic), sigs);
+        }
+        return sigs;
+    }
+
+    void match(const node &n, std::size_t i, signal_list &out) const {
+        if (i == m_segments.size()) {
+            if (n.sig && std::find(out.begin(), out.end(), n.sig) == out.end()) {
+                out.push_back(n.sig);
+            }
+        } else {
+            if (auto it = n.children.find(m_segments[i]); it != n.children.end()) {
+                match(*it->second, i + 1, out);
+            }
+            if (auto it = n.children.find(std::string_view{"*"}); it != n.children.end()) {
+                match(*it->second, i + 1, out);
+            }
+        }
+
+        // "#" swallows any number of the remaining segments
+        if (auto it = n.children.find(std::string_view{"#"}); it != n.children.end()) {
+            for (auto j = i; j <= m_segments.size(); ++j) {
+                match(*it->second, j, out);
+            }
+        }
+    }
+
+    static void disconnect_tree(node &n) {
+        if (n.sig) {
+            n.sig->disconnect_all();
+        }
+        for (auto &[seg, child] : n.children) {
+            disconnect_tree(*child);
+        }
+    }
+
+private:
+    mutable Lockable m_mutex;
+    node m_root;
+    std::size_t m_pattern_count = 0;
+    std::size_t m_cache_capacity;
+    detail::string_map<std::shared_ptr<const signal_list>> m_cache;
+    std::vector<std::string_view> m_segments;  // scratch space for resolution
+};
+
+/**
+ * Specializations for thread-safe and single-threaded topic buses
+ */
+template <typename... T>
+using topic_bus_st = topic_bus_base<detail::null_mutex, T...>;
+
+template <typename... T>
+using topic_bus = topic_bus_base<std::mutex, T...>;
+
+} // namespace sigslot
@@ -0,0 +1,213 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace sigslot {
+
+/**
+ * A work-stealing thread pool meant to run the slots of a signal concurrently,
+ * see signal_base::emit_parallel().
+ *
+ * Each worker owns a task queue it pops from the back, idle workers steal from
+ * the front of the queues of the others. The thread calling parallel_for()
+ * takes part in the work until all of it has been done, so that parallel_for()
+ * can be called from within a task without risking a deadlock.
+ */
+class work_stealing_pool {
+    // one parallel_for() call, living on the stack of its caller
+    struct batch {
+        void (*fn)(void *, std::size_t);
+        void *ctx;
+        std::atomic<std::size_t> remaining;
+        std::mutex error_mutex;
+        std::exception_ptr error;
+    };
+
+    struct task {
+        batch *b;
+        std::size_t index;
+    };
+
+    struct queue {
+        std::mutex mutex;
+        std::deque<task> tasks;
+    };
+
+public:
+    explicit work_stealing_pool(std::size_t threads = std::thread::hardware_concurrency()) {
+        threads = std::max<std::size_t>(threads, 1);
+
+        m_queues.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            m_queues.push_back(std::make_unique<queue>());
+        }
+
+        m_workers.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            m_workers.emplace_back([this, i] { run(i); });
+        }
+    }
+
+    work_stealing_pool(const work_stealing_pool &) = delete;
+    work_stealing_pool & operator=(const work_stealing_pool &) = delete;
+    work_stealing_pool(work_stealing_pool &&) = delete;
+    work_stealing_pool & operator=(work_stealing_pool &&) = delete;
+
+    ~work_stealing_pool() {
+        {
+            std::lock_guard<std::mutex> _{m_sleep_mutex};
+            m_stop = true;
+        }
+        m_sleep_cv.notify_all();
+
+        for (auto &w : m_workers) {
+            w.join();
+        }
+    }
+
+    /**
+     * Call f(i) for every i in [0, n) concurrently, and wait for completion
+     *
+     * The first exception thrown by f, if any, is rethrown once every call
+     * has completed.
+     * Safety: thread safe
+     */
+    template <typename F>
+    void parallel_for(std::size_t n, F && f) {
+        if (n == 0) {
+            return;
+        }
+
+        using fun_t = std::remove_reference_t<F>;
+        batch b{[](void *ctx, std::size_t i) { (*static_cast<fun_t*>(ctx))(i); },
+                const_cast<void*>(static_cast<const void*>(std::addressof(f))),
+                {n}, {}, {}};
+
+        // account for the tasks before they can be popped
+        {
+            std::lock_guard<std::mutex> _{m_sleep_mutex};
+            m_queued.fetch_add(n, std::memory_order_release);
+        }
+
+        // spread the tasks over the worker queues
+        const auto nq = m_queues.size();
+        const auto first = m_next.fetch_add(1, std::memory_order_relaxed);
+        for (std::size_t q = 0; q < nq && q < n; ++q) {
+            auto &qu = *m_queues[(first + q) % nq];
+            std::lock_guard<std::mutex> _{qu.mutex};
+            for (std::size_t i = q; i < n; i += nq) {
+                qu.tasks.push_back({&b, i});
+            }
+        }
+        m_sleep_cv.notify_all();
+
+        // help until every task has been taken, then wait for the running ones
+        task t{};
+        while (b.remaining.load(std::memory_order_acquire) > 0) {
+            if (steal(first % nq, t)) {
+                execute(t);
+            } else {
+                std::unique_lock<std::mutex> lock{m_done_mutex};
+                m_done_cv.wait(lock, [&b] {
+                    return b.remaining.load(std::memory_order_acquire) == 0;
+                });
+            }
+        }
+
+        if (b.error) {
+            std::rethrow_exception(b.error);
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return m_workers.size();
+    }
+
+private:
+    void run(std::size_t self) {
+        task t{};
+
+        while (true) {
+            if (pop(self, t) || steal(self, t)) {
+                execute(t);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock{m_sleep_mutex};
+            m_sleep_cv.wait(lock, [this] {
+                return m_stop || m_queued.load(std::memory_order_acquire) > 0;
+            });
+            if (m_stop) {
+                return;
+            }
+        }
+    }
+
+    bool pop(std::size_t q, task &t) {
+        auto &qu = *m_queues[q];
+        std::lock_guard<std::mutex> _{qu.mutex};
+        if (qu.tasks.empty()) {
+            return false;
+        }
+        t = qu.tasks.back();
+        qu.tasks.pop_back();
+        m_queued.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool steal(std::size_t self, task &t) {
+        const auto nq = m_queues.size();
+        for (std::size_t k = 1; k <= nq; ++k) {
+            auto &qu = *m_queues[(self + k) % nq];
+            std::lock_guard<std::mutex> _{qu.mutex};
+            if (!qu.tasks.empty()) {
+                t = qu.tasks.front();
+                qu.tasks.pop_front();
+                m_queued.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void execute(const task &t) {
+        auto *b = t.b;
+        try {
+            b->fn(b->ctx, t.index);
+        } catch (...) {
+            std::lock_guard<std::mutex> _{b->error_mutex};
+            if (!b->error) {
+                b->error = std::current_exception();
+            }
+        }
+
+        // the batch lives on the caller stack and may vanish as soon as its
+        // count drops to zero, hence the notification through the pool
+        if (b->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            { std::lock_guard<std::mutex> _{m_done_mutex}; }
+            m_done_cv.notify_all();
+        }
+    }
+
+private:
+    std::vector<std::unique_ptr<queue>> m_queues;
+    std::vector<std::thread> m_workers;
+    std::atomic<std::size_t> m_next{0};
+    std::atomic<std::size_t> m_queued{0};
+    std::mutex m_sleep_mutex;
+    std::condition_variable m_sleep_cv;
+    std::mutex m_done_mutex;
+    std::condition_variable m_done_cv;
+    bool m_stop = false;
+};
+
+} // namespace sigslot
@@ -0,0 +1,54 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <span>
+#include <tuple>
+#include <vector>
+
+static constexpr int slts = 20;
+static constexpr int batch_size = 10000;
+static constexpr int rounds = 50;
+
+template <typename Emit>
+static double run(Emit emit) {
+    using clock = std::chrono::steady_clock;
+
+    const auto begin = clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        emit();
+    }
+    const auto end = clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - begin).count() / (rounds * batch_size);
+}
+
+int main() {
+    sigslot::signal<int, double> sig;
+    long sum = 0;
+
+    for (int s = 0; s < slts; ++s) {
+        sig.connect([&](int i, double d) { sum += i + static_cast<long>(d); });
+    }
+
+    std::vector<std::tuple<int, double>> batch;
+    batch.reserve(batch_size);
+    for (int i = 0; i < batch_size; ++i) {
+        batch.emplace_back(i, 1.0);
+    }
+
+    const double loop_ns = run([&] {
+        for (const auto &[i, d] : batch) {
+            sig(i, d);
+        }
+    });
+    const double batch_ns = run([&] { sig.emit_batch(batch); });
+
+    std::cout << slts << " slots, batches of " << batch_size << " emissions" << std::endl;
+    std::cout << "emission loop: " << loop_ns << " ns/emission" << std::endl;
+    std::cout << "emit_batch:    " << batch_ns << " ns/emission" << std::endl;
+
+    assert(sum > 0);
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+static constexpr int slts = 200000;
+static constexpr int objects = 1000;
+static constexpr int scans = 20;
+
+struct obj {
+    void f(int) {}
+};
+
+// slots are never connected to a signal here
+struct no_cleaner : sigslot::detail::cleanable<int32_t> {
+    void clean(sigslot::detail::grouped_slot<int32_t> *) override {}
+    void clean_all(std::span<sigslot::detail::slot_state * const>) override {}
+};
+
+template <typename Run>
+static double run(long count, Run r) {
+    using clock = std::chrono::steady_clock;
+
+    const auto begin = clock::now();
+    r();
+    const auto end = clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - begin).count() / count;
+}
+
+// compare the ways of finding the slots bound to an object
+static void scan_kernels(std::vector<obj> &os) {
+    using slot_type = sigslot::detail::slot_pmf<int32_t, decltype(&obj::f), obj *, int>;
+    no_cleaner cleaner;
+
+    std::vector<sigslot::detail::slot_ptr<int32_t, int>> slots;
+    std::vector<sigslot::detail::obj_ptr> keys;
+    for (int i = 0; i < slts; ++i) {
+        auto *o = &os[static_cast<std::size_t>(i % objects)];
+        slots.push_back(std::make_shared<slot_type>(cleaner, &obj::f, o, 0));
+        keys.push_back(o);
+    }
+
+    std::size_t found = 0;
+    const auto count = static_cast<long>(scans) * slts;
+    const auto *target = &os[7];
+    const sigslot::detail::obj_ptr key = target;
+
+    const double virtual_ns = run(count, [&] {
+        for (int r = 0; r < scans; ++r) {
+            for (const auto &s : slots) {
+                found += s->has_object(target);
+            }
+        }
+    });
+
+    const double scalar_ns = run(count, [&] {
+        for (int r = 0; r < scans; ++r) {
+            sigslot::detail::find_keys_scalar(keys.data(), keys.size(), key, [&](std::size_t) { ++found; });
+        }
+    });
+
+    const double simd_ns = run(count, [&] {
+        for (int r = 0; r < scans; ++r) {
+            sigslot::detail::find_keys(keys.data(), keys.size(), key, [&](std::size_t) { ++found; });
+        }
+    });
+
+    assert(found == 3 * scans * slts / objects);
+
+    std::cout << "finding the slots of an object among " << slts << " slots" << std::endl;
+    std::cout << "virtual call per slot: " << virtual_ns << " ns/slot" << std::endl;
+    std::cout << "packed keys, scalar:   " << scalar_ns << " ns/slot" << std::endl;
+    std::cout << "packed keys, simd:     " << simd_ns << " ns/slot" << std::endl;
+}
+
+// tear down every object, one at a time
+static double teardown(std::vector<obj> &os, bool indexed) {
+    sigslot::signal<int> sig;
+    if (indexed) {
+        sig.enable_disconnect_index();
+    }
+    for (int i = 0; i < slts; ++i) {
+        sig.connect(&obj::f, &os[static_cast<std::size_t>(i % objects)]);
+    }
+
+    std::size_t count = 0;
+    const double ns = run(objects, [&] {
+        for (auto &o : os) {
+            count += sig.disconnect(&o);
+        }
+    });
+
+    assert(count == slts);
+    return ns;
+}
+
+int main() {
+    std::vector<obj> os(objects);
+
+    scan_kernels(os);
+
+    const double keyed_ns = teardown(os, false);
+    const double indexed_ns = teardown(os, true);
+
+    std::cout << "disconnecting " << objects << " objects bound to " << slts << " slots" << std::endl;
+    std::cout << "packed keys:   " << keyed_ns / 1000 << " us/object" << std::endl;
+    std::cout << "hash indexes:  " << indexed_ns / 1000 << " us/object" << std::endl;
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Emission throughput of the lock policies, with 1 to 64 emitting threads and
+ * another thread connecting and disconnecting a slot at a given rate.
+ *
+ * usage: bench-lock-policies [writes per second] [milliseconds per run]
+ */
+
+using clock_type = std::chrono::steady_clock;
+
+static constexpr int slts = 4;
+static constexpr int thread_counts[] = {1, 4, 16, 64};
+
+// million emissions per second, over all the emitting threads
+template <typename Sig>
+static double run(Sig &sig, int threads, long write_rate, std::chrono::milliseconds duration) {
+    for (int s = 0; s < slts; ++s) {
+        sig.connect([](int i) {
+            volatile int r = i;
+            (void)r;
+        });
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<long> emissions{0};
+
+    std::thread writer([&] {
+        if (write_rate <= 0) {
+            return;
+        }
+        const auto period = std::chrono::nanoseconds(1000000000L / write_rate);
+        auto next = clock_type::now();
+        while (!stop.load(std::memory_order_relaxed)) {
+            sig.connect([](int) {}).disconnect();
+            next += period;
+            std::this_thread::sleep_until(next);
+        }
+    });
+
+    std::vector<std::thread> emitters;
+    for (int t = 0; t < threads; ++t) {
+        emitters.emplace_back([&] {
+            long count = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int i = 0; i < 64; ++i) {
+                    sig(i);
+                }
+                count += 64;
+            }
+            emissions += count;
+        });
+    }
+
+    const auto begin = clock_type::now();
+    std::this_thread::sleep_for(duration);
+    stop = true;
+    for (auto &t : emitters) {
+        t.join();
+    }
+    const auto end = clock_type::now();
+    writer.join();
+
+    assert(sig.slot_count() == slts);
+    return static_cast<double>(emissions) / std::chrono::duration<double, std::micro>(end - begin).count();
+}
+
+template <typename Sig>
+static void bench(const char *name, long write_rate, std::chrono::milliseconds duration) {
+    std::cout << std::left << std::setw(14) << name;
+    for (int threads : thread_counts) {
+        Sig sig;
+        std::cout << std::right << std::setw(12) << std::fixed << std::setprecision(2)
+                  << run(sig, threads, write_rate, duration);
+    }
+    std::cout << std::endl;
+}
+
+// how often emissions found the adaptive mutex taken, and had to sleep
+static void contention(long write_rate, std::chrono::milliseconds duration) {
+    using sig_t = sigslot::signal_base<int32_t, sigslot::detail::counted_adaptive_mutex, int>;
+
+    std::cout << "adaptive mutex contention, % of the acquisitions" << std::endl;
+    for (int threads : thread_counts) {
+        sig_t sig;
+        run(sig, threads, write_rate, duration);
+        const auto st = sig.lock_stats();
+        const auto pct = [&](std::uint64_t n) {
+            return 100.0 * static_cast<double>(n) / static_cast<double>(st.acquisitions);
+        };
+        std::cout << std::setw(4) << threads << " threads: " << std::fixed << std::setprecision(2)
+                  << pct(st.contended) << " contended, " << pct(st.parked) << " parked" << std::endl;
+    }
+}
+
+int main(int argc, char **argv) {
+    const long write_rate = argc > 1 ? std::atol(argv[1]) : 1000;
+    const std::chrono::milliseconds duration{argc > 2 ? std::atol(argv[2]) : 100};
+
+    std::cout << "million emissions per second, " << slts << " slots, "
+              << write_rate << " writes per second" << std::endl;
+    std::cout << std::left << std::setw(14) << "threads";
+    for (int threads : thread_counts) {
+        std::cout << std::right << std::setw(12) << threads;
+    }
+    std::cout << std::endl;
+
+    bench<sigslot::signal<int>>("mutex", write_rate, duration);
+    bench<sigslot::signal_base<int32_t, sigslot::detail::spin_mutex, int>>("spin mutex", write_rate, duration);
+    bench<sigslot::signal_base<int32_t, sigslot::detail::adaptive_mutex, int>>("adaptive", write_rate, duration);
+    bench<sigslot::signal_rw<int>>("shared mutex", write_rate, duration);
+    bench<sigslot::signal_seq<int>>("seqlock", write_rate, duration);
+
+    contention(write_rate, duration);
+    return 0;
+}
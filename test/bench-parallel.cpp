@@ -0,0 +1,58 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <sigslot/work_stealing_pool.hpp>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+static constexpr int slts = 64;
+static constexpr int emissions = 200;
+static constexpr int work = 20000;
+
+// some cpu bound work, so that running slots in parallel pays off
+static double spin(int n) {
+    double acc = 0;
+    for (int i = 1; i <= n; ++i) {
+        acc += std::sqrt(static_cast<double>(i));
+    }
+    return acc;
+}
+
+template <typename Emit>
+static double run(Emit emit) {
+    using clock = std::chrono::steady_clock;
+
+    const auto begin = clock::now();
+    for (int e = 0; e < emissions; ++e) {
+        emit();
+    }
+    const auto end = clock::now();
+
+    return std::chrono::duration<double, std::micro>(end - begin).count() / emissions;
+}
+
+int main() {
+    sigslot::work_stealing_pool pool;
+    sigslot::signal<int> sig;
+    std::atomic<long> calls{0};
+
+    for (int s = 0; s < slts; ++s) {
+        sig.connect([&](int n) {
+            volatile double r = spin(n);
+            (void)r;
+            ++calls;
+        });
+    }
+
+    const double seq_us = run([&] { sig(work); });
+    const double par_us = run([&] { sig.emit_parallel(pool, work); });
+
+    std::cout << slts << " cpu bound slots, " << pool.size() << " threads" << std::endl;
+    std::cout << "sequential emission: " << seq_us << " us/emission" << std::endl;
+    std::cout << "parallel emission:   " << par_us << " us/emission" << std::endl;
+
+    assert(calls == 2L * slts * emissions);
+    return 0;
+}
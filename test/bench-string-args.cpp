@@ -0,0 +1,48 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+static constexpr int slts = 100;
+static constexpr int emissions = 100000;
+static constexpr std::size_t payload_size = 1024;
+
+template <typename Slot>
+static double run(Slot slt) {
+    using clock = std::chrono::steady_clock;
+
+    sigslot::signal<std::string> sig;
+    for (int s = 0; s < slts; ++s) {
+        sig.connect(slt);
+    }
+
+    const std::string payload(payload_size, 'x');
+
+    const auto begin = clock::now();
+    for (int e = 0; e < emissions; ++e) {
+        sig(payload);
+    }
+    const auto end = clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - begin).count() / emissions;
+}
+
+int main() {
+    std::size_t by_ref = 0;
+    std::size_t by_val = 0;
+
+    // slots taking const references receive the emitted string without copy,
+    // slots taking a value pay for one copy each, as every slot used to.
+    const double ref_ns = run([&](const std::string &s) { by_ref += s.size(); });
+    const double val_ns = run([&](std::string s) { by_val += s.size(); });
+
+    std::cout << "1 KB payload, " << slts << " slots" << std::endl;
+    std::cout << "const ref slots: " << ref_ns << " ns/emission" << std::endl;
+    std::cout << "by value slots:  " << val_ns << " ns/emission" << std::endl;
+
+    assert(by_ref == by_val);
+    assert(by_ref == std::size_t(slts) * emissions * payload_size);
+    return 0;
+}
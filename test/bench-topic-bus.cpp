@@ -0,0 +1,68 @@
+#include "test-common.h"
+#include <sigslot/topic_bus.hpp>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static constexpr int symbols = 100000;
+static constexpr int fields = 10;
+static constexpr int hot_topics = 1000;
+static constexpr int hot_rounds = 1000;
+
+template <typename Emit>
+static double run(long count, Emit emit) {
+    using clock = std::chrono::steady_clock;
+
+    const auto begin = clock::now();
+    emit();
+    const auto end = clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - begin).count() / count;
+}
+
+int main() {
+    sigslot::topic_bus<int> bus(65536);
+    long sum = 0;
+    auto add = [&](int i) { sum += i; };
+
+    // 100k subscriptions: one per symbol, on a field for most of them and on
+    // every field of the symbol for the rest, plus a few catch-all patterns
+    for (int s = 0; s < symbols; ++s) {
+        const auto sym = "md.s" + std::to_string(s);
+        bus.connect(s % 10 ? sym + ".f" + std::to_string(s % fields) : sym + ".*", add);
+    }
+    bus.connect("md.#", add);
+    bus.connect("#.f0", add);
+
+    // 1M distinct topics
+    std::vector<std::string> topics;
+    topics.reserve(symbols * fields);
+    for (int f = 0; f < fields; ++f) {
+        for (int s = 0; s < symbols; ++s) {
+            topics.push_back("md.s" + std::to_string(s) + ".f" + std::to_string(f));
+        }
+    }
+
+    const double cold_ns = run(static_cast<long>(topics.size()), [&] {
+        for (const auto &t : topics) {
+            bus.emit(t, 1);
+        }
+    });
+
+    const double hot_ns = run(static_cast<long>(hot_topics) * hot_rounds, [&] {
+        for (int r = 0; r < hot_rounds; ++r) {
+            for (int t = 0; t < hot_topics; ++t) {
+                bus.emit(topics[static_cast<std::size_t>(t)], 1);
+            }
+        }
+    });
+
+    std::cout << bus.pattern_count() << " patterns, " << topics.size() << " distinct topics" << std::endl;
+    std::cout << "distinct topics: " << cold_ns << " ns/emission" << std::endl;
+    std::cout << "repeat topics:   " << hot_ns << " ns/emission" << std::endl;
+
+    assert(sum > 0);
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+static constexpr int slts = 100;
+static constexpr int emissions = 100000;
+
+struct weak_obj {
+    void f(int &i) { ++i; }
+};
+
+struct tracked_obj : sigslot::trackable {
+    void f(int &i) { ++i; }
+};
+
+// emit from several threads at once, returns the time per slot call and thread
+template <typename Sig>
+static double run(Sig &sig, int threads) {
+    using clock = std::chrono::steady_clock;
+
+    std::vector<std::thread> ts;
+    const auto begin = clock::now();
+    for (int t = 0; t < threads; ++t) {
+        ts.emplace_back([&] {
+            int sum = 0;
+            for (int i = 0; i < emissions; ++i) {
+                sig(sum);
+            }
+            assert(sum == emissions * slts);
+        });
+    }
+    for (auto &t : ts) {
+        t.join();
+    }
+    const auto end = clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - begin).count() / (static_cast<double>(emissions) * slts * threads);
+}
+
+int main() {
+    // every slot tracks the same object, the worst case for a shared control block
+    auto weak = std::make_shared<weak_obj>();
+    tracked_obj tracked;
+
+    sigslot::signal<int &> weak_sig;
+    sigslot::signal<int &> tracked_sig;
+    for (int i = 0; i < slts; ++i) {
+        weak_sig.connect(&weak_obj::f, weak);
+        tracked_sig.connect(&tracked_obj::f, &tracked);
+    }
+
+    for (int threads : {1, 4}) {
+        const double weak_ns = run(weak_sig, threads);
+        const double tracked_ns = run(tracked_sig, threads);
+
+        std::cout << threads << " emitting thread(s), " << slts << " slots" << std::endl;
+        std::cout << "weak pointer tracking: " << weak_ns << " ns/call" << std::endl;
+        std::cout << "trackable:             " << tracked_ns << " ns/call" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,188 @@
+#include "test-common.h"
+#include <sigslot/conflated_signal.hpp>
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// an executor that runs tasks when told so
+struct manual_executor {
+    void post(std::function<void()> f) {
+        tasks.push_back(std::move(f));
+    }
+
+    std::size_t run() {
+        auto t = std::move(tasks);
+        tasks.clear();
+        for (auto &f : t) {
+            f();
+        }
+        return t.size();
+    }
+
+    std::vector<std::function<void()>> tasks;
+};
+
+void test_flush() {
+    sigslot::conflated_signal<int, std::string> sig;
+    std::vector<std::string> got;
+
+    sig.connect([&](int i, const std::string &s) { got.push_back(std::to_string(i) + s); });
+    assert(sig.slot_count() == 1);
+
+    assert(!sig.flush());
+    assert(!sig.dirty());
+
+    sig(1, "a");
+    sig(2, "b");
+    sig(3, "c");
+    assert(sig.dirty());
+    assert(got.empty());
+    assert(sig.coalesced() == 2);
+
+    assert(sig.flush());
+    assert((got == std::vector<std::string>{"3c"}));
+    assert(!sig.dirty());
+
+    assert(!sig.flush());
+    assert(got.size() == 1);
+
+    sig(4, "d");
+    assert(sig.flush());
+    assert((got == std::vector<std::string>{"3c", "4d"}));
+}
+
+void test_group() {
+    sigslot::conflation_group group;
+    sigslot::conflated_signal<int> a(group);
+    sigslot::conflated_signal<int> b(group);
+    sigslot::conflated_signal<int> c(group);
+    std::vector<int> got;
+
+    for (auto *s : {&a, &b, &c}) {
+        s->connect([&](int i) { got.push_back(i); });
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        b(i);
+        a(1000 + i);
+    }
+    assert(group.pending() == 2);
+
+    // one emission per dirty signal, in the order they became dirty
+    assert(group.flush() == 2);
+    assert((got == std::vector<int>{99, 1099}));
+    assert(group.pending() == 0);
+    assert(group.flush() == 0);
+
+    // a signal flushed on its own is skipped by the group
+    c(7);
+    assert(c.flush());
+    assert(group.flush() == 0);
+    assert(got.size() == 3);
+}
+
+void test_group_destroyed_member() {
+    sigslot::conflation_group group;
+    int sum = 0;
+
+    {
+        sigslot::conflated_signal<int> a(group);
+        a.connect([&](int i) { sum += i; });
+        a(1);
+        assert(group.pending() == 1);
+    }
+
+    assert(group.flush() == 0);
+    assert(sum == 0);
+}
+
+void test_dirty_during_flush() {
+    sigslot::conflation_group group;
+    sigslot::conflated_signal<int> a(group);
+    sigslot::conflated_signal<int> b(group);
+    std::vector<int> got;
+
+    a.connect([&](int i) { got.push_back(i); b(i + 1); });
+    b.connect([&](int i) { got.push_back(i); });
+
+    a(1);
+    assert(group.flush() == 1);
+    assert((got == std::vector<int>{1}));
+    assert(group.flush() == 1);
+    assert((got == std::vector<int>{1, 2}));
+}
+
+void test_executor() {
+    manual_executor ex;
+    sigslot::conflated_signal<int> sig(ex);
+    std::vector<int> got;
+
+    sig.connect([&](int i) { got.push_back(i); });
+
+    sig(1);
+    sig(2);
+    assert(ex.tasks.size() == 1);
+    assert(ex.run() == 1);
+    assert((got == std::vector<int>{2}));
+
+    sig(3);
+    assert(ex.run() == 1);
+    assert((got == std::vector<int>{2, 3}));
+}
+
+void test_threaded() {
+    sigslot::conflation_group group;
+    sigslot::conflated_signal<int> sig(group);
+    std::atomic<int> last{-1};
+    std::atomic<bool> done{false};
+
+    sig.connect([&](int i) {
+        // values are delivered in emission order, some being skipped
+        assert(i > last);
+        last = i;
+    });
+
+    std::thread producer([&] {
+        for (int i = 0; i < 10000; ++i) {
+            sig(i);
+        }
+        done = true;
+    });
+
+    while (!done) {
+        group.flush();
+    }
+    producer.join();
+    group.flush();
+    assert(last == 9999);
+}
+
+void test_single_threaded() {
+    sigslot::conflated_signal_st<std::string> sig;
+    std::string got;
+
+    sig.connect([&](const std::string &s) { got = s; });
+    sig("a");
+    sig("b");
+    sig.flush();
+    assert(got == "b");
+
+    sig.disconnect_all();
+    sig("c");
+    sig.flush();
+    assert(got == "b");
+}
+
+int main() {
+    test_flush();
+    test_group();
+    test_group_destroyed_member();
+    test_dirty_during_flush();
+    test_executor();
+    test_threaded();
+    test_single_threaded();
+    return 0;
+}
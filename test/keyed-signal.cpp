@@ -0,0 +1,149 @@
+#include "test-common.h"
+#include <sigslot/keyed_signal.hpp>
+#include <atomic>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct quote {
+    double price = 0.;
+    void on_price(double p) { price = p; }
+};
+
+void test_emit() {
+    sigslot::keyed_signal<std::string, double> sig;
+    double aapl = 0., msft = 0., aapl2 = 0.;
+
+    sig.connect("AAPL", [&](double p) { aapl = p; });
+    sig.connect("MSFT", [&](double p) { msft = p; });
+    sig.connect("AAPL", [&](double p) { aapl2 = 2 * p; });
+    assert(sig.key_count() == 2);
+    assert(sig.slot_count("AAPL") == 2);
+    assert(sig.slot_count("GOOG") == 0);
+
+    sig.emit("AAPL", 1.5);
+    assert(aapl == 1.5 && aapl2 == 3. && msft == 0.);
+
+    sig.emit("MSFT", 2.);
+    assert(msft == 2. && aapl == 1.5);
+
+    // unknown keys are ignored
+    sig.emit("GOOG", 3.);
+    assert(sig.key_count() == 2);
+}
+
+void test_slot_types() {
+    sigslot::keyed_signal<int, double> sig;
+    quote q;
+    int order = 0;
+    int first = 0, second = 0;
+
+    sig.connect(1, &quote::on_price, &q);
+    sig.connect(2, [&](double) { second = ++order; }, 2);
+    sig.connect(2, [&](double) { first = ++order; }, 1);
+    sig.connect_extended(3, [&](sigslot::connection &c, double) { c.disconnect(); });
+
+    sig.emit(1, 4.);
+    assert(q.price == 4.);
+
+    // groups are honored within a key
+    sig.emit(2, 0.);
+    assert(first == 1 && second == 2);
+
+    sig.emit(3, 0.);
+    assert(sig.slot_count(3) == 0);
+    assert(sig.key_count() == 3);
+}
+
+void test_disconnect() {
+    sigslot::keyed_signal<int, int> sig;
+    int sum = 0;
+    quote q;
+
+    auto c = sig.connect(1, [&](int i) { sum += i; });
+    sig.connect(1, [&](int i) { sum += 10 * i; });
+    sig.connect(2, [&](int i) { sum += 100 * i; });
+    sig.connect(3, &quote::on_price, &q);
+
+    c.disconnect();
+    sig.emit(1, 1);
+    assert(sum == 10);
+
+    assert(sig.disconnect(3, &q) == 1);
+    assert(sig.disconnect(4, &q) == 0);
+    assert(sig.key_count() == 3);
+
+    assert(sig.disconnect(1) == 1);
+    assert(sig.disconnect(1) == 0);
+    assert(sig.key_count() == 2);
+    sig.emit(1, 1);
+    assert(sum == 10);
+
+    sig.disconnect_all();
+    assert(sig.key_count() == 0);
+    sig.emit(2, 1);
+    assert(sum == 10);
+}
+
+void test_scoped_connection() {
+    sigslot::keyed_signal_st<int, int> sig;
+    int sum = 0;
+
+    {
+        sigslot::scoped_connection sc = sig.connect(1, [&](int i) { sum += i; });
+        sig.emit(1, 1);
+    }
+    sig.emit(1, 1);
+    assert(sum == 1);
+
+    // connections may outlive the signal
+    sigslot::connection c;
+    {
+        sigslot::keyed_signal_st<int, int> other;
+        c = other.connect(1, [](int) {});
+    }
+    assert(!c.connected());
+    c.disconnect();
+}
+
+void test_threaded() {
+    sigslot::keyed_signal<int, int> sig;
+    constexpr int keys = 8;
+    std::vector<std::atomic<int>> sums(keys);
+
+    for (int k = 0; k < keys; ++k) {
+        sig.connect(k, [&sums, k](int i) { sums[k] += i; });
+    }
+
+    std::vector<std::thread> threads;
+    for (int k = 0; k < keys; ++k) {
+        threads.emplace_back([&, k] {
+            for (int i = 0; i < 1000; ++i) {
+                sig.emit(k, 1);
+                // churn on a key nobody emits for
+                auto c = sig.connect(keys + k, [](int) {});
+                c.disconnect();
+            }
+            sig.disconnect(keys + k);
+        });
+    }
+
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    for (auto &s : sums) {
+        assert(s == 1000);
+    }
+    assert(sig.key_count() == keys);
+}
+
+int main() {
+    test_emit();
+    test_slot_types();
+    test_disconnect();
+    test_scoped_connection();
+    test_threaded();
+    return 0;
+}
@@ -0,0 +1,183 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+// a reader-writer lock counting how it gets taken
+struct counting_shared_mutex {
+    void lock() { ++exclusive; m.lock(); }
+    bool try_lock() { return m.try_lock() && ++exclusive > 0; }
+    void unlock() { m.unlock(); }
+    void lock_shared() { ++shared; m.lock_shared(); }
+    void unlock_shared() { m.unlock_shared(); }
+
+    std::shared_mutex m;
+    static inline std::atomic<int> exclusive{0};
+    static inline std::atomic<int> shared{0};
+};
+
+template <typename Sig>
+static void test_basics() {
+    int sum = 0;
+    Sig sig;
+
+    auto c1 = sig.connect([&](int i) { sum += i; });
+    sig.connect([&](int i) { sum += 10 * i; }, 1);
+    sig(1);
+    assert(sum == 11);
+
+    c1.disconnect();
+    sig(1);
+    assert(sum == 21);
+
+    sig.block();
+    sig(1);
+    assert(sum == 21);
+    sig.unblock();
+
+    sig.disconnect_all();
+    sig(1);
+    assert(sum == 21);
+    assert(sig.slot_count() == 0);
+}
+
+static void test_shared_emission() {
+    sigslot::signal_base<int32_t, counting_shared_mutex, int> sig;
+    int sum = 0;
+    sig.connect([&](int i) { sum += i; });
+
+    const int exclusive = counting_shared_mutex::exclusive;
+    assert(exclusive > 0);
+
+    for (int i = 0; i < 10; ++i) {
+        sig(1);
+    }
+    assert(sum == 10);
+    assert(counting_shared_mutex::shared == 10);
+    assert(counting_shared_mutex::exclusive == exclusive);
+}
+
+// emissions concurrent with a thread that keeps connecting and disconnecting
+template <typename Sig>
+static void test_churn() {
+    constexpr int emitters = 4;
+    constexpr int emissions = 5000;
+
+    Sig sig;
+    std::atomic<long> calls{0};
+    sig.connect([&](int) { calls.fetch_add(1, std::memory_order_relaxed); });
+
+    std::atomic<bool> stop{false};
+    std::thread churn([&] {
+        while (!stop.load()) {
+            auto c = sig.connect([](int) {});
+            sig.connect([](int) {}, 2).disconnect();
+            c.disconnect();
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < emitters; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < emissions; ++i) {
+                sig(i);
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    stop = true;
+    churn.join();
+
+    assert(calls == long{emitters} * emissions);
+    assert(sig.slot_count() == 1);
+}
+
+struct canary {
+    explicit canary(std::atomic<bool> &d) : dead{&d} {}
+    canary(const canary &o) : dead{o.dead} {}
+    ~canary() { dead->store(true); }
+    std::atomic<bool> *dead;
+};
+
+// emitting threads never destroy the slot lists of a seqlock signal
+static void test_seq_deferred_destruction() {
+    sigslot::signal_seq<> sig;
+    std::atomic<bool> dead{false};
+
+    sig.connect_extended([c = canary{dead}](sigslot::connection &conn) {
+        conn.disconnect();
+    });
+    dead = false;  // temporaries
+
+    // the emission drops the last reference to the list it went through
+    sig();
+    assert(!dead);
+
+    // and a write destroys it
+    sig.connect([] {});
+    assert(dead);
+}
+
+static void test_adaptive_mutex() {
+    constexpr int threads = 4;
+    constexpr int rounds = 20000;
+
+    sigslot::detail::counted_adaptive_mutex m;
+    long sum = 0;
+
+    assert(m.try_lock());
+    assert(!m.try_lock());
+    m.unlock();
+
+    std::vector<std::thread> ts;
+    for (int t = 0; t < threads; ++t) {
+        ts.emplace_back([&] {
+            for (int i = 0; i < rounds; ++i) {
+                std::lock_guard<sigslot::detail::counted_adaptive_mutex> _{m};
+                ++sum;
+            }
+        });
+    }
+    for (auto &t : ts) {
+        t.join();
+    }
+
+    assert(sum == long{threads} * rounds);
+    const auto st = m.stats();
+    assert(st.acquisitions == std::uint64_t{threads} * rounds + 1);
+    assert(st.contended <= st.acquisitions);
+}
+
+static void test_signal_lock_stats() {
+    sigslot::signal_base<int32_t, sigslot::detail::counted_adaptive_mutex, int> sig;
+    int sum = 0;
+    sig.connect([&](int i) { sum += i; });
+
+    const auto before = sig.lock_stats().acquisitions;
+    for (int i = 0; i < 10; ++i) {
+        sig(1);
+    }
+    assert(sum == 10);
+    assert(sig.lock_stats().acquisitions == before + 10);
+    assert(sig.lock_stats().contended == 0);
+}
+
+int main() {
+    test_basics<sigslot::signal_rw<int>>();
+    test_basics<sigslot::signal_seq<int>>();
+    test_shared_emission();
+    test_churn<sigslot::signal<int>>();
+    test_churn<sigslot::signal_rw<int>>();
+    test_churn<sigslot::signal_seq<int>>();
+    test_churn<sigslot::signal_base<int32_t, sigslot::detail::adaptive_mutex, int>>();
+    test_seq_deferred_destruction();
+    test_adaptive_mutex();
+    test_signal_lock_stats();
+    return 0;
+}
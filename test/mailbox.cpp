@@ -0,0 +1,174 @@
+#include "test-common.h"
+#include <sigslot/mailbox.hpp>
+#include <sigslot/signal.hpp>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <thread>
+#include <vector>
+
+static_assert(sigslot::trait::Executor<sigslot::mailbox>);
+
+void test_batched_dispatch() {
+    sigslot::mailbox mb(8);
+    std::vector<int> res;
+
+    for (int i = 0; i < 6; ++i) {
+        assert(mb.post([&res, i] { res.push_back(i); }));
+    }
+
+    assert(mb.size() == 6);
+    assert(mb.capacity() == 8);
+    assert(mb.dispatch(4) == 4);
+    assert((res == std::vector<int>{0, 1, 2, 3}));
+    assert(mb.dispatch() == 2);
+    assert(mb.empty());
+    assert(mb.peak_size() == 6);
+    assert((res == std::vector<int>{0, 1, 2, 3, 4, 5}));
+}
+
+void test_drop_newest() {
+    sigslot::mailbox mb(4, sigslot::OverflowPolicy::DROP_NEWEST);
+    std::vector<int> res;
+
+    for (int i = 0; i < 6; ++i) {
+        mb.post([&res, i] { res.push_back(i); });
+    }
+
+    assert(mb.dropped() == 2);
+    mb.dispatch();
+    assert((res == std::vector<int>{0, 1, 2, 3}));
+}
+
+void test_drop_oldest() {
+    sigslot::mailbox mb(4, sigslot::OverflowPolicy::DROP_OLDEST);
+    std::vector<int> res;
+
+    for (int i = 0; i < 6; ++i) {
+        assert(mb.post([&res, i] { res.push_back(i); }));
+    }
+
+    assert(mb.dropped() == 2);
+    mb.dispatch();
+    assert((res == std::vector<int>{2, 3, 4, 5}));
+}
+
+void test_grow() {
+    sigslot::mailbox mb(4, sigslot::OverflowPolicy::GROW);
+    std::vector<int> res;
+
+    for (int i = 0; i < 6; ++i) {
+        mb.post([&res, i] { res.push_back(i); });
+    }
+
+    assert(mb.size() == 6);
+    assert(mb.overflowed() == 2);
+    assert(mb.dropped() == 0);
+
+    // ordering is kept while the overflow queue is being drained
+    mb.dispatch(3);
+    mb.post([&res] { res.push_back(6); });
+    mb.dispatch();
+    assert((res == std::vector<int>{0, 1, 2, 3, 4, 5, 6}));
+
+    mb.post([&res] { res.push_back(7); });
+    assert(mb.overflowed() == 3);
+    mb.dispatch();
+    assert(res.back() == 7);
+}
+
+void test_block() {
+    sigslot::mailbox mb(4, sigslot::OverflowPolicy::BLOCK);
+    std::atomic<int> sum{0};
+    std::atomic<bool> done{false};
+
+    std::thread producer([&] {
+        for (int i = 0; i < 1000; ++i) {
+            mb.post([&sum] { ++sum; });
+        }
+        done = true;
+    });
+
+    while (!done || !mb.empty()) {
+        mb.dispatch(3);
+        std::this_thread::yield();
+    }
+
+    producer.join();
+    mb.dispatch();
+    assert(sum == 1000);
+    assert(mb.dropped() == 0);
+    assert(mb.peak_size() <= 4);
+}
+
+void test_signal_delivery() {
+    sigslot::mailbox mb(64);
+    sigslot::signal<int> sig;
+    std::int64_t sum = 0;
+    const auto consumer_id = std::this_thread::get_id();
+
+    sig.connect_queued([&](int i) {
+        assert(std::this_thread::get_id() == consumer_id);
+        sum += i;
+    }, mb);
+
+    std::atomic<int> running{4};
+    std::array<std::thread, 4> producers;
+    for (auto &t : producers) {
+        t = std::thread([&] {
+            for (int i = 0; i < 10000; ++i) {
+                sig(1);
+            }
+            --running;
+        });
+    }
+
+    while (running > 0 || !mb.empty()) {
+        if (mb.dispatch(16) == 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto &t : producers) {
+        t.join();
+    }
+
+    assert(sum == 40000);
+}
+
+void test_per_producer_order() {
+    sigslot::mailbox mb(16, sigslot::OverflowPolicy::GROW);
+    std::array<std::vector<int>, 2> seen;
+    std::array<std::thread, 2> producers;
+
+    for (std::size_t p = 0; p < producers.size(); ++p) {
+        producers[p] = std::thread([&, p] {
+            for (int i = 0; i < 5000; ++i) {
+                mb.post([&seen, p, i] { seen[p].push_back(i); });
+            }
+        });
+    }
+
+    for (auto &t : producers) {
+        t.join();
+    }
+    mb.dispatch();
+
+    for (auto &s : seen) {
+        assert(s.size() == 5000);
+        for (std::size_t i = 0; i < s.size(); ++i) {
+            assert(s[i] == int(i));
+        }
+    }
+}
+
+int main() {
+    test_batched_dispatch();
+    test_drop_newest();
+    test_drop_oldest();
+    test_grow();
+    test_block();
+    test_signal_delivery();
+    test_per_producer_order();
+    return 0;
+}
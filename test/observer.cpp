@@ -3,6 +3,7 @@
 #include <cassert>
 #include <list>
 #include <memory>
+#include <thread>
 #include <vector>
 
 
@@ -18,6 +19,16 @@ struct s_st : ::sigslot::observer_st {
     void f1 (int &i) { ++i; }
 };
 
+template <typename B>
+struct counted : B {
+    ~counted() override {
+        this->disconnect_all();
+    }
+
+    void f1 (int &i) { ++i; }
+    std::size_t count() const { return this->connection_count(); }
+};
+
 struct s_plain {
     void f1 (int &i) { ++i; }
 };
@@ -146,6 +157,116 @@ void test_observer_signals_vector() {
     assert(sum == 10);
 }
 
+template <typename T, template <typename...> class SIG_T>
+void test_observer_pruning() {
+    T p;
+    int sum = 0;
+
+    {
+        SIG_T<int &> sig;
+        for (int i = 0; i < 100; ++i) {
+            auto c = sig.connect(&T::f1, &p);
+            assert(p.count() == 1);
+            c.disconnect();
+            assert(p.count() == 0);
+        }
+
+        sig.connect(&T::f1, &p);
+        sig.connect(&T::f1, &p, 1);
+        assert(p.count() == 2);
+        assert(sig.disconnect(&p) == 2);
+        assert(p.count() == 0);
+
+        sig.connect(&T::f1, &p, 2);
+        assert(sig.disconnect(2) == 1);
+        sig.connect(&T::f1, &p);
+        sig.disconnect_all();
+        assert(p.count() == 0);
+
+        {
+            sigslot::scoped_connection sc = sig.connect(&T::f1, &p);
+            assert(p.count() == 1);
+        }
+        assert(p.count() == 0);
+
+        sig.connect(&T::f1, &p);
+        sig(sum);
+        assert(sum == 1);
+    }
+
+    // the signal went away
+    assert(p.count() == 0);
+
+    // the observer goes away first
+    SIG_T<int &> sig;
+    {
+        T q;
+        sig.connect(&T::f1, &q);
+        sig.connect(&T::f1, &q);
+        assert(q.count() == 2);
+    }
+    assert(sig.slot_count() == 0);
+}
+
+template <typename T, template <typename...> class SIG_T>
+void test_observer_bulk_teardown() {
+    SIG_T<int &> sig1;
+    SIG_T<int &> sig2;
+    s_plain other;
+    int sum = 0;
+
+    for (int i = 0; i < 10; ++i) {
+        sig1.connect(&s_plain::f1, &other, i % 3);
+    }
+
+    {
+        T p;
+        std::vector<sigslot::connection> conns;
+        for (int i = 0; i < 1000; ++i) {
+            conns.push_back(sig1.connect(&T::f1, &p, i % 3));
+            sig2.connect(&T::f1, &p);
+        }
+        assert(p.count() == 2000);
+
+        // some of them leave beforehand
+        for (std::size_t i = 0; i < conns.size(); i += 2) {
+            conns[i].disconnect();
+        }
+        assert(p.count() == 1500);
+        assert(sig1.slot_count() == 510);
+    }
+
+    assert(sig1.slot_count() == 10);
+    assert(sig2.slot_count() == 0);
+    sig1(sum);
+    assert(sum == 10);
+}
+
+void test_observer_threaded() {
+    sigslot::signal<int &> sig;
+    int sum = 0;
+
+    std::thread t([&] {
+        for (int i = 0; i < 1000; ++i) {
+            counted<sigslot::observer> o;
+            sig.connect(&counted<sigslot::observer>::f1, &o);
+            auto c = sig.connect(&counted<sigslot::observer>::f1, &o);
+            c.disconnect();
+        }
+    });
+
+    for (int i = 0; i < 1000; ++i) {
+        int local = 0;
+        sig(local);
+        sig.disconnect_all();
+    }
+
+    t.join();
+    assert(sig.slot_count() == 0);
+    sig(sum);
+    assert(sum == 0);
+}
+
 int main()
 {
     test_observer<s, sigslot::signal>();
@@ -158,5 +279,10 @@ int main()
     test_observer_signals_list<s_st, sigslot::signal_st>();
     test_observer_signals_vector<s, sigslot::signal>();
     test_observer_signals_vector<s_st, sigslot::signal_st>();
+    test_observer_pruning<counted<sigslot::observer>, sigslot::signal>();
+    test_observer_pruning<counted<sigslot::observer_st>, sigslot::signal_st>();
+    test_observer_bulk_teardown<counted<sigslot::observer>, sigslot::signal>();
+    test_observer_bulk_teardown<counted<sigslot::observer_st>, sigslot::signal_st>();
+    test_observer_threaded();
     return 0;
 }
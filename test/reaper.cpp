@@ -0,0 +1,143 @@
+#include "test-common.h"
+#include <sigslot/reaper.hpp>
+#include <sigslot/signal.hpp>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+struct o {
+    void f(int &i) { ++i; }
+};
+
+struct t : sigslot::trackable {
+    void f(int &i) { ++i; }
+};
+
+void test_collect_expired() {
+    sigslot::signal<int &> sig;
+    int sum = 0;
+
+    auto p1 = std::make_shared<o>();
+    auto p2 = std::make_shared<o>();
+    auto p3 = std::make_unique<t>();
+    o plain;
+
+    sig.connect(&o::f, p1);
+    sig.connect(&o::f, p2);
+    sig.connect([](int &i) { ++i; }, p1, 1);
+    sig.connect(&t::f, p3.get(), 2);
+    sig.connect(&o::f, &plain);
+    assert(sig.collect_expired() == 0);
+
+    p1.reset();
+    p3.reset();
+    assert(sig.slot_count() == 5);
+
+    // in batches
+    assert(sig.collect_expired(2) == 2);
+    assert(sig.collect_expired(2) == 1);
+    assert(sig.collect_expired() == 0);
+    assert(sig.slot_count() == 2);
+
+    sig(sum);
+    assert(sum == 2);
+}
+
+void test_deferred_cleanup() {
+    sigslot::signal<int &> sig;
+    int sum = 0;
+
+    auto p = std::make_shared<o>();
+    auto c = sig.connect(&o::f, p);
+    sig.defer_expired_cleanup();
+
+    // the emission skips the slot without removing it
+    p.reset();
+    assert(!c.connected());
+    sig(sum);
+    assert(sum == 0);
+    assert(sig.slot_count() == 1);
+
+    assert(sig.collect_expired() == 1);
+    assert(sig.slot_count() == 0);
+}
+
+void test_reaper() {
+    sigslot::signal<int &> sig1;
+    sigslot::signal<int &> sig2;
+    sigslot::reaper r(std::chrono::hours(1), 2);
+
+    {
+        auto reg1 = r.add(sig1);
+        auto reg2 = r.add(sig2);
+        assert(reg1.active() && reg2.active());
+
+        std::vector<std::shared_ptr<o>> ps;
+        for (int i = 0; i < 5; ++i) {
+            ps.push_back(std::make_shared<o>());
+            sig1.connect(&o::f, ps.back());
+            sig2.connect(&o::f, ps.back());
+        }
+        ps.resize(1);
+
+        int sum = 0;
+        sig1(sum);
+        assert(sum == 1);
+        assert(sig1.slot_count() == 5);
+
+        assert(r.collect() == 8);
+        assert(r.collected() == 8);
+        assert(sig1.slot_count() == 1 && sig2.slot_count() == 1);
+    }
+
+    // the signals remove expired slots themselves again
+    auto p = std::make_shared<o>();
+    sig1.connect(&o::f, p);
+    p.reset();
+    int sum = 0;
+    sig1(sum);
+    assert(sig1.slot_count() == 0);
+    assert(r.collect() == 0);
+}
+
+void test_reaper_thread() {
+    sigslot::signal<int &> sig;
+    sigslot::reaper r(std::chrono::milliseconds(1));
+    auto reg = r.add(sig);
+
+    std::atomic<bool> run{true};
+    std::thread emitter([&] {
+        while (run) {
+            int sum = 0;
+            sig(sum);
+        }
+    });
+
+    for (int i = 0; i < 1000; ++i) {
+        auto p = std::make_shared<o>();
+        auto q = std::make_unique<t>();
+        sig.connect(&o::f, p);
+        sig.connect(&t::f, q.get());
+    }
+
+    // wait for the reaper to catch up
+    for (int i = 0; i < 10000 && sig.slot_count() > 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    run = false;
+    emitter.join();
+
+    assert(sig.slot_count() == 0);
+    assert(r.collected() == 2000);
+}
+
+int main() {
+    test_collect_expired();
+    test_deferred_cleanup();
+    test_reaper();
+    test_reaper_thread();
+    return 0;
+}
@@ -0,0 +1,159 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+// count the deallocations made by the thread under watch
+static thread_local bool watched = false;
+static std::atomic<long> frees{0};
+
+void operator delete(void *p) noexcept {
+    if (watched) {
+        ++frees;
+    }
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    ::operator delete(p);
+}
+
+// counts its live instances
+struct canary {
+    explicit canary(int &a) : alive{&a} { ++*alive; }
+    canary(const canary &o) : alive{o.alive} { ++*alive; }
+    ~canary() { --*alive; }
+    int *alive;
+};
+
+struct o {
+    void f(int &i) { ++i; }
+};
+
+template <typename E>
+static long frees_during(E &&emit) {
+    frees = 0;
+    watched = true;
+    emit();
+    watched = false;
+    return frees;
+}
+
+void test_deferred_destruction() {
+    sigslot::reclaimer r;
+    sigslot::signal<int &> sig;
+    sig.set_reclaimer(&r);
+
+    int alive = 0;
+    auto p = std::make_shared<o>();
+    {
+        // slots disconnecting themselves, or finding their object dead
+        canary c(alive);
+        sig.connect_extended([c, s = std::string(100, 'x')](sigslot::connection &conn, int &) {
+            conn.disconnect();
+        });
+        sig.connect(&o::f, p);
+        sig.connect([c](int &i) { ++i; });
+    }
+    p.reset();
+    assert(alive == 2);
+
+    int sum = 0;
+    assert(frees_during([&] { sig(sum); }) == 0);
+    assert(sum == 1);
+    assert(sig.slot_count() == 1);
+
+    // the slots are destroyed on reclaim, along with the list they were in
+    assert(alive == 2);
+    assert(!r.empty());
+    assert(r.reclaim() == 1);
+    assert(alive == 1);
+    assert(r.empty());
+
+    // without an emission going through the list, it gets modified in place
+    sig.disconnect_all();
+    assert(alive == 0);
+    assert(r.empty());
+}
+
+void test_immediate_destruction() {
+    sigslot::reclaimer r;
+    sigslot::signal<int &> sig;
+    sig.set_reclaimer(&r);
+    sig.set_reclaimer(nullptr);
+
+    int alive = 0;
+    {
+        canary c(alive);
+        sig.connect_extended([c](sigslot::connection &conn, int &) { conn.disconnect(); });
+    }
+
+    int sum = 0;
+    sig(sum);
+    assert(alive == 0);
+    assert(r.empty());
+}
+
+void test_outliving_connection() {
+    sigslot::reclaimer r;
+    sigslot::connection c;
+    int alive = 0;
+    {
+        sigslot::signal<int &> sig;
+        sig.set_reclaimer(&r);
+        sig.connect_extended([&sig](sigslot::connection &, int &) { sig.disconnect_all(); });
+        c = sig.connect([cn = canary(alive)](int &) {});
+        int sum = 0;
+        sig(sum);
+    }
+
+    // the slot waits in the reclaimer, unreachable from its connection
+    assert(alive == 1);
+    assert(!c.connected());
+    assert(!c.disconnect());
+    r.reclaim();
+    assert(alive == 0);
+}
+
+void test_threaded() {
+    sigslot::reclaimer r;
+    sigslot::signal<int &> sig;
+    sig.set_reclaimer(&r);
+
+    std::atomic<bool> run{true};
+    std::atomic<long> emit_frees{0};
+    std::thread emitter([&] {
+        while (run) {
+            int sum = 0;
+            emit_frees += frees_during([&] { sig(sum); });
+        }
+    });
+
+    // connections and disconnections copy the list the emitter is reading
+    int alive = 0;
+    for (int i = 0; i < 1000; ++i) {
+        auto c = sig.connect([cn = canary(alive)](int &) {});
+        c.disconnect();
+        r.reclaim();
+    }
+
+    run = false;
+    emitter.join();
+    r.reclaim();
+    assert(emit_frees == 0);
+    assert(alive == 0);
+}
+
+int main() {
+    test_deferred_destruction();
+    test_immediate_destruction();
+    test_outliving_connection();
+    test_threaded();
+    return 0;
+}
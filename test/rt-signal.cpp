@@ -0,0 +1,203 @@
+#include "test-common.h"
+#include <sigslot/rt_signal.hpp>
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+// count the allocations, deallocations and locks of threads under watch
+static thread_local bool watched = false;
+static thread_local long allocs = 0;
+static thread_local long frees = 0;
+static thread_local long locks = 0;
+
+void * operator new(std::size_t n) {
+    if (watched) {
+        ++allocs;
+    }
+    if (void *p = std::malloc(n ? n : 1)) {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+// not inlined, lest the compiler match std::free against operator new
+[[gnu::noinline]] void operator delete(void *p) noexcept {
+    if (watched) {
+        ++frees;
+    }
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    ::operator delete(p);
+}
+
+struct counting_mutex {
+    void lock() {
+        if (watched) {
+            ++locks;
+        }
+        m.lock();
+    }
+
+    bool try_lock() {
+        if (watched) {
+            ++locks;
+        }
+        return m.try_lock();
+    }
+
+    void unlock() {
+        m.unlock();
+    }
+
+    std::mutex m;
+};
+
+using rt_sig = sigslot::rt_signal_base<counting_mutex, int &>;
+
+// run an emission, checking that it neither allocates, frees nor locks
+template <typename E>
+static void real_time(E &&emit) {
+    allocs = frees = locks = 0;
+    watched = true;
+    emit();
+    watched = false;
+    assert(allocs == 0 && frees == 0 && locks == 0);
+}
+
+struct o {
+    void f(int &i) { i += 100; }
+};
+
+void test_emission() {
+    rt_sig sig;
+    int sum = 0;
+    o obj;
+    auto p = std::make_shared<o>();
+    std::vector<int> order;
+
+    sig.connect([&](int &i) { ++i; order.push_back(2); }, 2);
+    sig.connect([&](int &i) { ++i; order.push_back(1); }, 1);
+    sig.connect([&](int &i) { ++i; order.push_back(3); }, 2);
+    sig.connect(&o::f, &obj);
+    sig.connect(&o::f, p);
+    assert(sig.slot_count() == 5);
+
+    order.reserve(10);
+    real_time([&] { sig(sum); });
+    assert(sum == 203);
+    assert((order == std::vector<int>{1, 2, 3}));
+}
+
+void test_disconnection() {
+    rt_sig sig;
+    int sum = 0;
+    auto p = std::make_shared<o>();
+
+    auto c = sig.connect([](int &i) { ++i; });
+    sig.connect_extended([s = std::string(100, 'x')](sigslot::connection &conn, int &i) {
+        i += 10;
+        conn.disconnect();
+    });
+    sig.connect(&o::f, p);
+    p.reset();
+
+    // disconnected and expired slots are skipped, without being destroyed
+    real_time([&] { sig(sum); });
+    assert(sum == 11);
+    real_time([&] {
+        c.disconnect();
+        sig(sum);
+    });
+    assert(sum == 11);
+    assert(sig.slot_count() == 3);
+
+    assert(sig.cleanup() == 3);
+    assert(sig.cleanup() == 0);
+    assert(sig.slot_count() == 0);
+    assert(!c.connected());
+}
+
+void test_write_from_slot() {
+    rt_sig sig;
+    int sum = 0;
+
+    // the snapshot being read is not destroyed by the write
+    sig.connect_extended([&sig](sigslot::connection &conn, int &i) {
+        ++i;
+        conn.disconnect();
+        sig.connect([](int &j) { j += 10; });
+    });
+    sig(sum);
+    assert(sum == 1);
+    sig(sum);
+    assert(sum == 11);
+
+    sig.connect_extended([&sig](sigslot::connection &, int &) { sig.disconnect_all(); });
+    sig(sum);
+    assert(sig.slot_count() == 0);
+}
+
+void test_outliving_connection() {
+    sigslot::connection c;
+    {
+        rt_sig sig;
+        c = sig.connect([](int &) {});
+    }
+    assert(!c.connected());
+    assert(!c.disconnect());
+}
+
+void test_threaded() {
+    rt_sig sig;
+    std::atomic<bool> run{true};
+    std::atomic<long> violations{0};
+    sig.connect([](int &i) { ++i; });
+
+    std::vector<std::thread> emitters;
+    for (int t = 0; t < 4; ++t) {
+        emitters.emplace_back([&] {
+            while (run) {
+                int sum = 0;
+                allocs = frees = locks = 0;
+                watched = true;
+                sig(sum);
+                watched = false;
+                violations += allocs + frees + locks;
+                assert(sum >= 1);
+            }
+        });
+    }
+
+    // writers churn on the slots while the emitters run
+    for (int i = 0; i < 2000; ++i) {
+        auto c = sig.connect([s = std::string(100, 'x')](int &j) { j += static_cast<int>(s.size()); });
+        if (i % 2) {
+            c.disconnect();
+            sig.cleanup();
+        }
+    }
+
+    run = false;
+    for (auto &e : emitters) {
+        e.join();
+    }
+    assert(violations == 0);
+    assert(sig.slot_count() == 1001);
+}
+
+int main() {
+    test_emission();
+    test_disconnection();
+    test_write_from_slot();
+    test_outliving_connection();
+    test_threaded();
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <sigslot/shared_payload.hpp>
+#include <atomic>
+#include <cassert>
+#include <thread>
+#include <vector>
+
+struct frame {
+    // frames get constructed concurrently by the pools of the threaded test
+    static inline std::atomic<int> constructions{0};
+    static inline std::atomic<int> copies{0};
+
+    frame() { ++constructions; }
+    explicit frame(std::size_t n) : data(n, 1) { ++constructions; }
+    frame(const frame &o) : data(o.data) { ++copies; }
+    frame(frame &&o) noexcept : data(std::move(o.data)) {}
+    frame & operator=(const frame &o) { data = o.data; ++copies; return *this; }
+    frame & operator=(frame &&o) noexcept { data = std::move(o.data); return *this; }
+    ~frame() = default;
+
+    std::vector<int> data;
+};
+
+static void reset() {
+    frame::constructions = 0;
+    frame::copies = 0;
+}
+
+void test_fan_out_without_copy() {
+    sigslot::signal<sigslot::shared_payload<frame>> sig;
+    std::size_t sum = 0;
+    std::size_t max_count = 0;
+
+    for (int i = 0; i < 50; ++i) {
+        sig.connect([&](const sigslot::shared_payload<frame> &p) {
+            sum += p->data.size();
+            max_count = std::max(max_count, p.use_count());
+        });
+        // slots may also take the payload value directly
+        sig.connect([&](const frame &f) { sum += f.data.size(); });
+    }
+
+    reset();
+    sig(frame(1000));
+    assert(sum == 100 * 1000);
+    assert(frame::constructions == 1);
+    assert(frame::copies == 0);
+    assert(max_count == 1);
+}
+
+void test_kept_payload() {
+    sigslot::signal<sigslot::shared_payload<frame>> sig;
+    std::vector<sigslot::shared_payload<frame>> kept;
+
+    sig.connect([&](const sigslot::shared_payload<frame> &p) { kept.push_back(p); });
+    sig.connect([&](const sigslot::shared_payload<frame> &p) { kept.push_back(p); });
+
+    reset();
+    auto p = sigslot::make_shared_payload<frame>(10);
+    sig(p);
+
+    assert(frame::constructions == 1);
+    assert(frame::copies == 0);
+    assert(p.use_count() == 3);
+    assert(kept[0].get() == p.get());
+    assert(kept[1].get() == p.get());
+
+    kept.clear();
+    assert(p.use_count() == 1);
+}
+
+void test_pool_recycling() {
+    sigslot::payload_pool<frame> pool(2);
+    sigslot::signal<sigslot::shared_payload<frame>> sig;
+    sigslot::shared_payload<frame> kept;
+    sig.connect([&](const sigslot::shared_payload<frame> &p) { kept = p; });
+
+    const frame *first = nullptr;
+    {
+        auto u = pool.acquire();
+        u->data.assign(100, 2);
+        first = u.get();
+        sig(std::move(u));
+    }
+
+    assert(pool.allocated() == 1);
+    assert(pool.idle() == 0);
+    kept = {};
+    assert(pool.idle() == 1);
+
+    // the released buffer is reused as is, with its capacity
+    auto u = pool.acquire();
+    assert(u.get() == first);
+    assert(u->data.capacity() >= 100);
+    assert(pool.allocated() == 1);
+    assert(pool.recycled() == 1);
+    assert(pool.idle() == 0);
+}
+
+void test_pool_outlived() {
+    sigslot::shared_payload<frame> p;
+    {
+        sigslot::payload_pool<frame> pool;
+        p = pool.acquire();
+    }
+    assert(p);
+    assert(p.use_count() == 1);
+}
+
+void test_threaded_release() {
+    sigslot::payload_pool<frame> pool(4);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 1000; ++i) {
+                sigslot::shared_payload<frame> p = pool.acquire();
+                auto q = p;
+                assert(q.use_count() == 2);
+            }
+        });
+    }
+
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    assert(pool.idle() <= 4);
+    assert(pool.allocated() <= 4);
+}
+
+int main() {
+    test_fan_out_without_copy();
+    test_kept_payload();
+    test_pool_recycling();
+    test_pool_outlived();
+    test_threaded_release();
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <cassert>
+#include <span>
+#include <string>
+#include <tuple>
+#include <vector>
+
+void test_emit_batch() {
+    sigslot::signal<int, std::string> sig;
+    std::vector<std::string> got;
+    int sum = 0;
+
+    sig.connect([&](int i, const std::string &s) { got.push_back(std::to_string(i) + s); });
+    sig.connect([&](int i, std::string) { sum += i; });
+
+    const std::vector<std::tuple<int, std::string>> batch{{1, "a"}, {2, "b"}, {3, "c"}};
+    sig.emit_batch(batch);
+
+    assert((got == std::vector<std::string>{"1a", "2b", "3c"}));
+    assert(sum == 6);
+
+    sig.emit_batch({});
+    assert(got.size() == 3);
+
+    sig.block();
+    sig.emit_batch(batch);
+    assert(got.size() == 3);
+}
+
+void test_slot_major_order() {
+    sigslot::signal<int> sig;
+    std::vector<int> order;
+
+    sig.connect([&](int i) { order.push_back(i); }, 1);
+    sig.connect([&](int i) { order.push_back(10 * i); }, 2);
+
+    const std::vector<std::tuple<int>> batch{{1}, {2}};
+    sig.emit_batch(batch);
+
+    // each slot processes the whole batch, in group order
+    assert((order == std::vector<int>{1, 2, 10, 20}));
+}
+
+void test_blocked_slot() {
+    sigslot::signal<int> sig;
+    int sum = 0;
+
+    auto c = sig.connect([&](int i) { sum += i; });
+    sig.connect_extended([&](sigslot::connection &conn, int i) {
+        sum += 100 * i;
+        // the slot keeps receiving the rest of the batch
+        conn.disconnect();
+    });
+
+    c.block();
+    const std::vector<std::tuple<int>> batch{{1}, {2}};
+    sig.emit_batch(batch);
+    assert(sum == 300);
+
+    c.unblock();
+    sig.emit_batch(batch);
+    assert(sum == 303);
+}
+
+void test_connect_batch() {
+    sigslot::signal<int> sig;
+    std::vector<std::size_t> sizes;
+    int sum = 0;
+
+    sig.connect_batch([&](std::span<const std::tuple<int>> b) {
+        sizes.push_back(b.size());
+        for (const auto &[i] : b) {
+            sum += i;
+        }
+    });
+
+    const std::vector<std::tuple<int>> batch{{1}, {2}, {3}};
+    sig.emit_batch(batch);
+    assert((sizes == std::vector<std::size_t>{3}));
+    assert(sum == 6);
+
+    // a regular emission is a batch of one
+    sig(4);
+    assert((sizes == std::vector<std::size_t>{3, 1}));
+    assert(sum == 10);
+}
+
+void test_reference_arguments() {
+    sigslot::signal<int &> sig;
+    sig.connect([](int &i) { ++i; });
+
+    int a = 0;
+    int b = 10;
+    const std::vector<std::tuple<int &>> batch{{a}, {b}};
+    sig.emit_batch(batch);
+    assert(a == 1 && b == 11);
+}
+
+void test_signal_interface() {
+    struct owner {
+        sigslot::signal_ix<owner, int> sig;
+        void fire(std::span<const std::tuple<int>> b) { sig.emit_batch(b); }
+    };
+
+    owner o;
+    int sum = 0;
+    o.sig.connect_batch([&](std::span<const std::tuple<int>> b) {
+        for (const auto &[i] : b) {
+            sum += i;
+        }
+    });
+
+    const std::vector<std::tuple<int>> batch{{1}, {2}};
+    o.fire(batch);
+    assert(sum == 3);
+}
+
+int main() {
+    test_emit_batch();
+    test_slot_major_order();
+    test_blocked_slot();
+    test_connect_batch();
+    test_reference_arguments();
+    test_signal_interface();
+    return 0;
+}
@@ -0,0 +1,320 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <cassert>
+#include <coroutine>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+// a coroutine type that starts right away and owns itself
+struct detached {
+    struct promise_type {
+        detached get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+// a manually opened gate, to simulate an asynchronous operation
+struct gate {
+    struct awaiter {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> h) { g->waiting.push_back(h); }
+        void await_resume() const noexcept {}
+        gate *g;
+    };
+
+    awaiter wait() { return {this}; }
+
+    void open() {
+        auto w = std::move(waiting);
+        waiting.clear();
+        for (auto h : w) {
+            h.resume();
+        }
+    }
+
+    std::vector<std::coroutine_handle<>> waiting;
+};
+
+// a coroutine type that starts right away and is destroyed with its handle
+struct owned {
+    struct promise_type {
+        owned get_return_object() noexcept {
+            return owned{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    explicit owned(std::coroutine_handle<promise_type> h) : handle{h} {}
+    owned(const owned &) = delete;
+    owned & operator=(const owned &) = delete;
+    ~owned() { handle.destroy(); }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+owned own(sigslot::task<> &t) {
+    co_await t;
+}
+
+template <typename R>
+detached run(sigslot::task<R> t, bool &done) {
+    co_await t;
+    done = true;
+}
+
+void test_next() {
+    sigslot::signal<int, std::string> sig;
+    std::vector<std::tuple<int, std::string>> got;
+
+    auto consumer = [&]() -> detached {
+        for (int n = 0; n < 2; ++n) {
+            got.push_back(co_await sig.next());
+        }
+    };
+    consumer();
+
+    sig(1, "one");
+    sig(2, "two");
+    sig(3, "three");
+
+    assert(got.size() == 2);
+    assert(std::get<0>(got[0]) == 1 && std::get<1>(got[0]) == "one");
+    assert(std::get<0>(got[1]) == 2 && std::get<1>(got[1]) == "two");
+}
+
+void test_next_after_slots() {
+    sigslot::signal<int> sig;
+    int sum = 0;
+    int seen = 0;
+
+    sig.connect([&](int i) { sum += i; });
+
+    auto consumer = [&]() -> detached {
+        auto [i] = co_await sig.next();
+        seen = sum + i;
+    };
+    consumer();
+
+    sig.block();
+    sig(1);
+    assert(seen == 0);
+
+    sig.unblock();
+    sig(2);
+    assert(seen == 4);
+}
+
+void test_next_many_awaiters() {
+    sigslot::signal<> sig;
+    int woken = 0;
+
+    auto consumer = [&]() -> detached {
+        co_await sig.next();
+        ++woken;
+    };
+
+    for (int i = 0; i < 10; ++i) {
+        consumer();
+    }
+
+    sig();
+    assert(woken == 10);
+    sig();
+    assert(woken == 10);
+}
+
+void test_next_cancellation() {
+    sigslot::signal<int> sig;
+    int got = 0;
+
+    auto waiter = [&]() -> sigslot::task<> {
+        auto [i] = co_await sig.next();
+        got += i;
+    };
+
+    {
+        // destroying a suspended coroutine makes it leave the signal
+        auto t = waiter();
+        auto o = own(t);
+    }
+
+    sig(1);
+    assert(got == 0);
+
+    bool done = false;
+    run(waiter(), done);
+    sig(2);
+    assert(got == 2);
+    assert(done);
+}
+
+void test_next_threaded() {
+    sigslot::signal<int> sig;
+    std::atomic<int> got{0};
+    std::atomic<bool> waiting{false};
+
+    auto consumer = [&]() -> detached {
+        waiting = true;
+        auto [i] = co_await sig.next();
+        got = i;
+    };
+    consumer();
+
+    std::thread th([&] { sig(5); });
+    th.join();
+    assert(got == 5);
+}
+
+void test_connect_async() {
+    sigslot::signal<int> sig;
+    gate g;
+    int sum = 0;
+
+    sig.connect_async([&](int i) -> sigslot::task<> {
+        co_await g.wait();
+        sum += i;
+    });
+
+    // synchronous emission launches the task, which completes on its own
+    sig(1);
+    sig(2);
+    assert(sum == 0);
+    assert(g.waiting.size() == 2);
+
+    g.open();
+    assert(sum == 3);
+}
+
+void test_emit_async() {
+    sigslot::signal<std::string> sig;
+    gate g;
+    std::vector<std::string> events;
+
+    sig.connect([&](const std::string &s) { events.push_back("sync " + s); });
+    for (int n = 0; n < 3; ++n) {
+        sig.connect_async([&](const std::string &s) -> sigslot::task<> {
+            co_await g.wait();
+            // the argument lives in the emission task
+            events.push_back("async " + s);
+        });
+    }
+
+    bool done = false;
+    run(sig.emit_async("x"), done);
+
+    // all async slots have started concurrently
+    assert(!done);
+    assert(g.waiting.size() == 3);
+    assert(events.size() == 1);
+
+    g.open();
+    assert(done);
+    assert(events.size() == 4);
+    assert(events[3] == "async x");
+}
+
+void test_emit_async_wakes_awaiters() {
+    sigslot::signal<int> sig;
+    int got = 0;
+
+    auto consumer = [&]() -> detached {
+        auto [i] = co_await sig.next();
+        got = i;
+    };
+    consumer();
+
+    bool done = false;
+    run(sig.emit_async(7), done);
+    assert(done);
+    assert(got == 7);
+}
+
+void test_emit_async_exception() {
+    sigslot::signal<int> sig;
+    gate g;
+    int calls = 0;
+
+    for (int n = 0; n < 2; ++n) {
+        sig.connect_async([&](int i) -> sigslot::task<> {
+            co_await g.wait();
+            ++calls;
+            if (i == 0) {
+                throw std::runtime_error("zero");
+            }
+        });
+    }
+
+    bool caught = false;
+    auto emitter = [&]() -> detached {
+        try {
+            co_await sig.emit_async(0);
+        } catch (const std::runtime_error &) {
+            caught = true;
+        }
+    };
+    emitter();
+
+    g.open();
+    assert(calls == 2);
+    assert(caught);
+}
+
+void test_task_result() {
+    auto answer = []() -> sigslot::task<int> { co_return 42; };
+    int res = 0;
+
+    auto consumer = [&]() -> detached {
+        res = co_await answer();
+    };
+    consumer();
+    assert(res == 42);
+}
+
+void test_signal_interface() {
+    struct owner {
+        sigslot::signal_ix<owner, int> sig;
+        sigslot::task<> fire(int i) { return sig.emit_async(i); }
+    };
+
+    owner o;
+    int got = 0;
+    int sum = 0;
+
+    o.sig.connect_async([&](int i) -> sigslot::task<> { sum += i; co_return; });
+
+    auto consumer = [&]() -> detached {
+        auto [i] = co_await o.sig.next();
+        got = i;
+    };
+    consumer();
+
+    bool done = false;
+    run(o.fire(3), done);
+    assert(done);
+    assert(got == 3);
+    assert(sum == 3);
+}
+
+int main() {
+    test_next();
+    test_next_after_slots();
+    test_next_many_awaiters();
+    test_next_cancellation();
+    test_next_threaded();
+    test_connect_async();
+    test_emit_async();
+    test_emit_async_wakes_awaiters();
+    test_emit_async_exception();
+    test_task_result();
+    test_signal_interface();
+    return 0;
+}
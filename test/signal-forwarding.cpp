@@ -0,0 +1,131 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <cassert>
+#include <string>
+
+struct counted {
+    static inline int copies = 0;
+    static inline int conversions = 0;
+
+    counted() = default;
+    explicit counted(int v) : value(v) { ++conversions; }
+    counted(const counted &o) : value(o.value) { ++copies; }
+    counted(counted &&o) noexcept : value(o.value) {}
+    counted & operator=(const counted &o) { value = o.value; ++copies; return *this; }
+    counted & operator=(counted &&o) noexcept { value = o.value; return *this; }
+    ~counted() = default;
+
+    int value = 0;
+};
+
+struct converts_to_counted {
+    // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+    operator counted() const { return counted{v}; }
+    int v;
+};
+
+static void reset() {
+    counted::copies = 0;
+    counted::conversions = 0;
+}
+
+void test_no_copy_fan_out() {
+    int sum = 0;
+    sigslot::signal<counted> sig;
+
+    for (int i = 0; i < 100; ++i) {
+        sig.connect([&](const counted &c) { sum += c.value; });
+    }
+
+    reset();
+    counted c{1};
+    sig(c);
+    assert(sum == 100);
+    assert(counted::copies == 0);
+
+    sig(std::move(c));
+    assert(sum == 200);
+    assert(counted::copies == 0);
+}
+
+void test_single_conversion() {
+    int sum = 0;
+    sigslot::signal<counted> sig;
+
+    for (int i = 0; i < 10; ++i) {
+        sig.connect([&](const counted &c) { sum += c.value; });
+    }
+
+    reset();
+    sig(converts_to_counted{2});
+    assert(sum == 20);
+    assert(counted::conversions == 1);
+    assert(counted::copies == 0);
+}
+
+void test_mutable_reference_gets_a_copy() {
+    int sum = 0;
+    sigslot::signal<counted> sig;
+
+    sig.connect([&](counted &c) { c.value += 10; sum += c.value; });
+    sig.connect([&](counted &c) { c.value += 10; sum += c.value; });
+    sig.connect([&](const counted &c) { sum += c.value; });
+
+    reset();
+    counted c{1};
+    sig(c);
+    assert(sum == 11 + 11 + 1);
+    assert(c.value == 1);
+    assert(counted::copies == 2);
+}
+
+void test_by_value_slot() {
+    int sum = 0;
+    sigslot::signal<std::string> sig;
+
+    sig.connect([&](std::string s) { s += "!"; sum += int(s.size()); });
+    sig.connect([&](const std::string &s) { sum += int(s.size()); });
+
+    sig("hello");
+    assert(sum == 6 + 5);
+}
+
+void test_reference_arguments() {
+    sigslot::signal<int&> sig;
+    sig.connect([](int &i) { ++i; });
+    sig.connect([](int &i) { ++i; });
+
+    int i = 0;
+    sig(i);
+    assert(i == 2);
+}
+
+struct pm {
+    void f(const counted &c) { sum += c.value; }
+    void g(counted &c) { c.value = 0; }
+    int sum = 0;
+};
+
+void test_pmf_no_copy() {
+    sigslot::signal<counted> sig;
+    pm p;
+
+    sig.connect(&pm::f, &p);
+    sig.connect(&pm::g, &p);
+    sig.connect(&pm::f, &p);
+
+    reset();
+    sig(counted{3});
+    assert(p.sum == 6);
+    assert(counted::copies == 1);
+}
+
+int main() {
+    test_no_copy_fan_out();
+    test_single_conversion();
+    test_mutable_reference_gets_a_copy();
+    test_by_value_slot();
+    test_reference_arguments();
+    test_pmf_no_copy();
+    return 0;
+}
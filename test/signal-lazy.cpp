@@ -0,0 +1,187 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <cassert>
+#include <coroutine>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+// a coroutine type that starts right away and owns itself
+struct detached {
+    struct promise_type {
+        detached get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+void test_has_listeners() {
+    sigslot::signal<int> sig;
+    assert(!sig.has_listeners());
+
+    auto c1 = sig.connect([](int) {});
+    auto c2 = sig.connect([](int) {}, 1);
+    assert(sig.has_listeners());
+
+    sig.block();
+    assert(!sig.has_listeners());
+    sig.unblock();
+    assert(sig.has_listeners());
+
+    c1.block();
+    assert(sig.has_listeners());
+    c2.block();
+    assert(!sig.has_listeners());
+
+    // blocking twice must not count twice
+    c2.block();
+    c2.unblock();
+    assert(sig.has_listeners());
+
+    sig.block(1);
+    assert(!sig.has_listeners());
+    sig.unblock(1);
+    assert(sig.has_listeners());
+
+    c2.disconnect();
+    assert(!sig.has_listeners());
+
+    // a blocked slot that gets disconnected is not accounted for twice
+    c1.disconnect();
+    c1.unblock();
+    assert(!sig.has_listeners());
+
+    sig.connect([](int) {});
+    assert(sig.has_listeners());
+    sig.disconnect_all();
+    assert(!sig.has_listeners());
+}
+
+void test_has_listeners_disconnect() {
+    sigslot::signal<int> sig;
+    auto fn = [](int) {};
+
+    sig.connect(fn);
+    sig.connect(fn);
+    assert(sig.has_listeners());
+    assert(sig.disconnect(fn) == 2);
+    assert(!sig.has_listeners());
+
+    {
+        sigslot::scoped_connection sc = sig.connect(fn);
+        assert(sig.has_listeners());
+    }
+    assert(!sig.has_listeners());
+}
+
+void test_has_listeners_watchers() {
+    sigslot::signal<int> sig;
+
+    {
+        auto s = sig.stream(4);
+        assert(sig.has_listeners());
+    }
+    assert(!sig.has_listeners());
+
+    int got = 0;
+    auto consumer = [&]() -> detached {
+        auto [i] = co_await sig.next();
+        got = i;
+    };
+    consumer();
+    assert(sig.has_listeners());
+
+    sig(3);
+    assert(got == 3);
+    assert(!sig.has_listeners());
+}
+
+void test_emit_lazy() {
+    sigslot::signal<int, std::string> sig;
+    int produced = 0;
+    std::string got;
+
+    auto producer = [&] {
+        ++produced;
+        return std::tuple{1, std::string("one")};
+    };
+
+    sig.emit_lazy(producer);
+    assert(produced == 0);
+
+    auto c = sig.connect([&](int i, const std::string &s) { got = std::to_string(i) + s; });
+    sig.emit_lazy(producer);
+    assert(produced == 1);
+    assert(got == "1one");
+
+    c.block();
+    sig.emit_lazy(producer);
+    assert(produced == 1);
+
+    c.unblock();
+    sig.block();
+    sig.emit_lazy(producer);
+    assert(produced == 1);
+}
+
+void test_emit_lazy_reference() {
+    sigslot::signal<int &> sig;
+    sig.connect([](int &i) { ++i; });
+
+    int i = 0;
+    sig.emit_lazy([&] { return std::tie(i); });
+    assert(i == 1);
+}
+
+void test_moved_signal() {
+    sigslot::signal<int> sig;
+    sig.connect([](int) {});
+    sig.block();
+
+    sigslot::signal<int> moved{std::move(sig)};
+    assert(moved.blocked());
+    assert(!moved.has_listeners());
+    moved.unblock();
+    assert(moved.has_listeners());
+    assert(sig.blocked());
+    assert(!sig.has_listeners());
+}
+
+void test_threaded() {
+    sigslot::signal<int> sig;
+    auto c = sig.connect([](int) {});
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 10000; ++i) {
+                sigslot::connection_blocker b = c.blocker();
+                auto other = sig.connect([](int) {});
+                other.disconnect();
+            }
+        });
+    }
+
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    assert(sig.has_listeners());
+    c.block();
+    assert(!sig.has_listeners());
+}
+
+int main() {
+    test_has_listeners();
+    test_has_listeners_disconnect();
+    test_has_listeners_watchers();
+    test_emit_lazy();
+    test_emit_lazy_reference();
+    test_moved_signal();
+    test_threaded();
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <sigslot/work_stealing_pool.hpp>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+static_assert(sigslot::trait::ParallelExecutor<sigslot::work_stealing_pool>);
+
+void test_parallel_for() {
+    sigslot::work_stealing_pool pool(4);
+    assert(pool.size() == 4);
+
+    std::vector<std::atomic<int>> hits(1000);
+    pool.parallel_for(hits.size(), [&](std::size_t i) { hits[i]++; });
+    for (auto &h : hits) {
+        assert(h == 1);
+    }
+
+    pool.parallel_for(0, [](std::size_t) { assert(false); });
+}
+
+void test_emit_parallel() {
+    sigslot::work_stealing_pool pool(4);
+    sigslot::signal<int, const std::string &> sig;
+    std::atomic<int> sum{0};
+
+    for (int i = 0; i < 50; ++i) {
+        sig.connect([&](int v, const std::string &s) { sum += v * static_cast<int>(s.size()); });
+    }
+
+    sig.emit_parallel(pool, 2, std::string("abc"));
+    assert(sum == 300);
+
+    sig.block();
+    sig.emit_parallel(pool, 2, std::string("abc"));
+    assert(sum == 300);
+}
+
+void test_slots_run_concurrently() {
+    sigslot::work_stealing_pool pool(4);
+    sigslot::signal<> sig;
+    std::atomic<int> running{0};
+    std::atomic<int> peak{0};
+
+    for (int i = 0; i < 8; ++i) {
+        sig.connect([&] {
+            int r = ++running;
+            int p = peak.load();
+            while (r > p && !peak.compare_exchange_weak(p, r)) {}
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            --running;
+        });
+    }
+
+    sig.emit_parallel(pool);
+    assert(running == 0);
+    assert(peak > 1);
+}
+
+void test_group_ordering() {
+    sigslot::work_stealing_pool pool(4);
+    sigslot::signal<> sig;
+    std::mutex mutex;
+    std::vector<int> order;
+
+    for (int g : {3, 1, 2}) {
+        for (int i = 0; i < 10; ++i) {
+            sig.connect([&, g] {
+                std::lock_guard<std::mutex> _{mutex};
+                order.push_back(g);
+            }, g);
+        }
+    }
+
+    sig.emit_parallel(pool);
+    assert(order.size() == 30);
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        assert(order[i] == static_cast<int>(i / 10) + 1);
+    }
+}
+
+void test_exception() {
+    sigslot::work_stealing_pool pool(2);
+    sigslot::signal<int> sig;
+    std::atomic<int> calls{0};
+
+    for (int i = 0; i < 10; ++i) {
+        sig.connect([&](int v) {
+            ++calls;
+            if (v == 0) {
+                throw std::runtime_error("zero");
+            }
+        });
+    }
+
+    bool thrown = false;
+    try {
+        sig.emit_parallel(pool, 0);
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+
+    // every slot of the group still ran
+    assert(thrown);
+    assert(calls == 10);
+
+    sig.emit_parallel(pool, 1);
+    assert(calls == 20);
+}
+
+void test_nested_emission() {
+    sigslot::work_stealing_pool pool(2);
+    sigslot::signal<int> inner;
+    sigslot::signal<> outer;
+    std::atomic<int> sum{0};
+
+    for (int i = 0; i < 4; ++i) {
+        inner.connect([&](int v) { sum += v; });
+        outer.connect([&] { inner.emit_parallel(pool, 1); });
+    }
+
+    outer.emit_parallel(pool);
+    assert(sum == 16);
+}
+
+int main() {
+    test_parallel_for();
+    test_emit_parallel();
+    test_slots_run_concurrently();
+    test_group_ordering();
+    test_exception();
+    test_nested_emission();
+    return 0;
+}
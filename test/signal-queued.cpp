@@ -0,0 +1,200 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <sigslot/shared_payload.hpp>
+#include <sigslot/thread_pool.hpp>
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// an executor that runs tasks when told so
+struct manual_executor {
+    void post(std::function<void()> f) {
+        tasks.push_back(std::move(f));
+    }
+
+    std::size_t run() {
+        auto t = std::move(tasks);
+        tasks.clear();
+        for (auto &f : t) {
+            f();
+        }
+        return t.size();
+    }
+
+    std::vector<std::function<void()>> tasks;
+};
+
+static_assert(sigslot::trait::Executor<manual_executor>);
+static_assert(sigslot::trait::Executor<sigslot::thread_pool>);
+
+void test_deferred_delivery() {
+    manual_executor ex;
+    sigslot::signal<int> sig;
+    int sum = 0;
+
+    sig.connect_queued([&](int i) { sum += i; }, ex);
+    sig.connect([&](int i) { sum += 10 * i; });
+
+    sig(1);
+    assert(sum == 10);
+    assert(ex.tasks.size() == 1);
+
+    assert(ex.run() == 1);
+    assert(sum == 11);
+}
+
+void test_arguments_are_copied() {
+    manual_executor ex;
+    sigslot::signal<std::string, int&> sig;
+    std::string res;
+
+    sig.connect_queued([&](const std::string &s, int &i) { res = s + std::to_string(i); }, ex);
+
+    {
+        std::string s = "abc";
+        int i = 4;
+        sig(s, i);
+    }
+
+    ex.run();
+    assert(res == "abc4");
+}
+
+void test_group_order() {
+    manual_executor ex;
+    sigslot::signal<std::vector<int>&> sig;
+    std::vector<int> order;
+
+    sig.connect_queued([](std::vector<int> &) {}, ex, 3);
+    sig.connect_queued([&](std::vector<int> &) { order.push_back(3); }, ex, 3);
+    sig.connect_queued([&](std::vector<int> &) { order.push_back(1); }, ex, 1);
+    sig.connect_queued([&](std::vector<int> &) { order.push_back(2); }, ex, 2);
+
+    std::vector<int> dummy;
+    sig(dummy);
+    ex.run();
+
+    assert((order == std::vector<int>{1, 2, 3}));
+}
+
+void test_blocking() {
+    manual_executor ex;
+    sigslot::signal<int> sig;
+    int sum = 0;
+
+    auto c = sig.connect_queued([&](int i) { sum += i; }, ex);
+
+    c.block();
+    sig(1);
+    assert(ex.tasks.empty());
+
+    c.unblock();
+    sig(1);
+    c.block();
+    ex.run();
+    assert(sum == 0);
+
+    c.unblock();
+    sig(1);
+    ex.run();
+    assert(sum == 1);
+}
+
+void test_disconnection() {
+    manual_executor ex;
+    int sum = 0;
+
+    {
+        sigslot::signal<int> sig;
+        auto c = sig.connect_queued([&](int i) { sum += i; }, ex);
+
+        sig(1);
+        c.disconnect();
+        ex.run();
+        assert(sum == 0);
+
+        sig.connect_queued([&](int i) { sum += i; }, ex);
+        sig(1);
+    }
+
+    // the signal is gone along with its slots
+    assert(ex.run() == 1);
+    assert(sum == 0);
+}
+
+void test_shared_payload() {
+    manual_executor ex;
+    sigslot::signal<sigslot::shared_payload<std::string>> sig;
+    std::size_t count = 0;
+
+    sig.connect_queued([&](const sigslot::shared_payload<std::string> &p) { count = p.use_count(); }, ex);
+    sig.connect_queued([&](const std::string &s) { assert(s == "payload"); }, ex);
+
+    auto p = sigslot::make_shared_payload<std::string>("payload");
+    sig(p);
+    assert(p.use_count() == 3);
+
+    ex.run();
+    assert(count == 3);
+    assert(p.use_count() == 1);
+}
+
+void test_thread_pool() {
+    std::atomic<int> sum{0};
+    std::atomic<bool> other_thread{true};
+    const auto this_id = std::this_thread::get_id();
+
+    sigslot::thread_pool pool(2);
+    sigslot::signal<int> sig;
+
+    sig.connect_queued([&](int i) {
+        sum += i;
+        if (std::this_thread::get_id() == this_id) {
+            other_thread = false;
+        }
+    }, pool);
+
+    for (int i = 0; i < 1000; ++i) {
+        sig(1);
+    }
+
+    pool.wait_idle();
+    assert(sum == 1000);
+    assert(other_thread);
+}
+
+void test_thread_pool_order() {
+    std::vector<int> order;
+
+    {
+        // the pool drains its tasks on destruction, before the signal goes away
+        sigslot::signal<> sig;
+        sigslot::thread_pool pool;
+        sig.connect_queued([&] { order.push_back(2); }, pool, 2);
+        sig.connect_queued([&] { order.push_back(1); }, pool, 1);
+
+        for (int i = 0; i < 100; ++i) {
+            sig();
+        }
+    }
+
+    assert(order.size() == 200);
+    for (std::size_t i = 0; i < order.size(); i += 2) {
+        assert(order[i] == 1 && order[i+1] == 2);
+    }
+}
+
+int main() {
+    test_deferred_delivery();
+    test_arguments_are_copied();
+    test_group_order();
+    test_blocking();
+    test_disconnection();
+    test_shared_payload();
+    test_thread_pool();
+    test_thread_pool_order();
+    return 0;
+}
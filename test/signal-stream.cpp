@@ -0,0 +1,177 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <atomic>
+#include <cassert>
+#include <coroutine>
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+// a coroutine type that starts right away and owns itself
+struct detached {
+    struct promise_type {
+        detached get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+void test_try_next() {
+    sigslot::signal<int, std::string> sig;
+    auto s = sig.stream(4);
+
+    assert(s.capacity() == 4);
+    assert(s.policy() == sigslot::ConflationPolicy::KEEP_ALL);
+    assert(!s.try_next());
+
+    sig(1, "one");
+    sig(2, "two");
+    assert(s.size() == 2);
+
+    auto v = s.try_next();
+    assert(v && std::get<0>(*v) == 1 && std::get<1>(*v) == "one");
+    v = s.try_next();
+    assert(v && std::get<0>(*v) == 2 && std::get<1>(*v) == "two");
+    assert(!s.try_next());
+    assert(s.overflow_count() == 0);
+}
+
+void test_keep_all_overflow() {
+    sigslot::signal<int> sig;
+    auto s = sig.stream(3);
+
+    for (int i = 0; i < 5; ++i) {
+        sig(i);
+    }
+
+    // the oldest emissions were dropped
+    assert(s.size() == 3);
+    assert(s.overflow_count() == 2);
+    for (int i = 2; i < 5; ++i) {
+        assert(std::get<0>(*s.try_next()) == i);
+    }
+}
+
+void test_keep_latest() {
+    sigslot::signal<int> sig;
+    auto s = sig.stream(8, sigslot::ConflationPolicy::KEEP_LATEST);
+    assert(s.capacity() == 1);
+
+    for (int i = 0; i < 5; ++i) {
+        sig(i);
+    }
+
+    assert(s.size() == 1);
+    assert(s.overflow_count() == 4);
+    assert(std::get<0>(*s.try_next()) == 4);
+}
+
+void test_consumer_coroutine() {
+    sigslot::signal<int> sig;
+    auto s = sig.stream(16);
+    std::vector<int> got;
+    bool ended = false;
+
+    auto consumer = [&]() -> detached {
+        while (auto v = co_await s.next()) {
+            got.push_back(std::get<0>(*v));
+        }
+        ended = true;
+    };
+
+    // buffered emissions are consumed right away, then the consumer waits
+    sig(1);
+    sig(2);
+    consumer();
+    assert((got == std::vector<int>{1, 2}));
+
+    sig(3);
+    assert((got == std::vector<int>{1, 2, 3}));
+
+    s.close();
+    assert(ended);
+
+    sig(4);
+    assert(got.size() == 3);
+}
+
+void test_close_on_signal_destruction() {
+    bool ended = false;
+    std::optional<sigslot::signal<int>> sig{std::in_place};
+    auto s = sig->stream(4);
+
+    auto consumer = [&]() -> detached {
+        while (co_await s.next()) {}
+        ended = true;
+    };
+    consumer();
+
+    sig.reset();
+    assert(ended);
+    assert(s.closed());
+}
+
+void test_detach_on_destruction() {
+    sigslot::signal<int> sig;
+    {
+        auto s1 = sig.stream(4);
+        auto s2 = sig.stream(4);
+        sig(1);
+        assert(s1.size() == 1 && s2.size() == 1);
+    }
+    sig(2);
+
+    auto s = sig.stream(4);
+    sig(3);
+    assert(std::get<0>(*s.try_next()) == 3);
+}
+
+void test_threaded() {
+    sigslot::signal<int> sig;
+    auto s = sig.stream(1024);
+    constexpr int count = 1000;
+
+    std::thread th([&] {
+        for (int i = 0; i < count; ++i) {
+            sig(i);
+        }
+    });
+
+    int expected = 0;
+    while (expected < count) {
+        if (auto v = s.try_next()) {
+            assert(std::get<0>(*v) == expected);
+            ++expected;
+        }
+    }
+    th.join();
+    assert(s.overflow_count() == 0);
+}
+
+void test_signal_interface() {
+    struct owner {
+        sigslot::signal_ix<owner, int> sig;
+        void fire(int i) { sig(i); }
+    };
+
+    owner o;
+    auto s = o.sig.stream(2);
+    o.fire(5);
+    assert(std::get<0>(*s.try_next()) == 5);
+}
+
+int main() {
+    test_try_next();
+    test_keep_all_overflow();
+    test_keep_latest();
+    test_consumer_coroutine();
+    test_close_on_signal_destruction();
+    test_detach_on_destruction();
+    test_threaded();
+    test_signal_interface();
+    return 0;
+}
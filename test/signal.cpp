@@ -40,10 +40,13 @@ struct o8 { void operator()(int i) const volatile noexcept { sum += i; } };
 
 void test_slot_count() {
     sigslot::signal<int> sig;
+    const auto &csig = sig;
     s p;
 
+    assert(csig.empty());
     sig.connect(&s::f1, &p);
     assert(sig.slot_count() == 1);
+    assert(!csig.empty());
     sig.connect(&s::f2, &p);
     assert(sig.slot_count() == 2);
     sig.connect(&s::f3, &p);
@@ -65,9 +68,19 @@ void test_slot_count() {
     assert(sig.slot_count() == 7);
     conn.disconnect();
     assert(sig.slot_count() == 6);
+    conn.disconnect();
+    assert(sig.slot_count() == 6);
 
-    sig.disconnect_all();
-    assert(sig.slot_count() == 0);
+    assert(sig.disconnect(&s::f1) == 1);
+    assert(csig.slot_count() == 5);
+
+    sigslot::signal<int> moved{std::move(sig)};
+    assert(moved.slot_count() == 5);
+    assert(sig.empty());
+
+    moved.disconnect_all();
+    assert(moved.slot_count() == 0);
+    assert(moved.empty());
 }
 
 void test_free_connection() {
@@ -671,6 +684,141 @@ void test_loop() {
     assert(i2.val() == 1);
 }
 
+void test_disconnection_indexed() {
+    // indexed before connecting
+    {
+        sum = 0;
+        sigslot::signal<int> sig;
+        sig.enable_disconnect_index();
+        assert(sig.disconnect_index_enabled());
+        s p1, p2;
+
+        sig.connect(f1);
+        sig.connect(f2);
+        sig.connect(f2, 1);
+        sig.connect(&s::f1, &p1);
+        sig.connect(&s::f1, &p2);
+        sig.connect(&s::f2, &p1);
+        sig.connect([](int i) { sum += 100 * i; });
+        sig(1);
+        assert(sum == 108);
+
+        assert(sig.disconnect(&f2) == 2);
+        assert(sig.disconnect(&f2) == 0);
+        sig(1);
+        assert(sum == 212);
+
+        assert(sig.disconnect(&s::f1, &p2) == 1);
+        assert(sig.disconnect(&p1) == 2);
+        assert(sig.disconnect(&p2) == 0);
+        sig(1);
+        assert(sum == 313);
+        assert(sig.slot_count() == 2);
+    }
+
+    // indexed after connecting, slots leaving by other means
+    {
+        sum = 0;
+        sigslot::signal<int> sig;
+        s p;
+
+        auto c = sig.connect(&s::f1, &p);
+        sig.connect(&s::f2, &p, 1);
+        sig.connect(&s::f3, &p, 2);
+        sig.connect(&s::f4, &p);
+        sig.enable_disconnect_index();
+
+        c.disconnect();
+        assert(sig.disconnect(1) == 1);
+        assert(sig.disconnect(&p) == 2);
+        sig(1);
+        assert(sum == 0);
+
+        sig.connect(f1);
+        sig.disconnect_all();
+        assert(sig.disconnect(f1) == 0);
+        sig.connect(f1);
+        sig(1);
+        assert(sum == 1);
+    }
+
+    // disconnect by tracker
+    {
+        sum = 0;
+        sigslot::signal<int> sig;
+        sig.enable_disconnect_index();
+
+        auto t = std::make_shared<bool>();
+        sig.connect(f1);
+        sig.connect(f2);
+        sig.connect(f1, t);
+        sig.connect(f2, t);
+        assert(sig.disconnect(f2, t) == 1);
+        assert(sig.disconnect(t) == 1);
+        sig(1);
+        assert(sum == 3);
+    }
+
+    // the index follows the slots on move
+    {
+        sum = 0;
+        sigslot::signal<int> sig;
+        sig.enable_disconnect_index();
+        sig.connect(f1);
+
+        sigslot::signal<int> moved{std::move(sig)};
+        assert(moved.disconnect_index_enabled());
+        assert(!sig.disconnect_index_enabled());
+        assert(moved.disconnect(f1) == 1);
+    }
+
+#ifdef SIGSLOT_RTTI_ENABLED
+    // disconnect by function object and lambda
+    {
+        sum = 0;
+        sigslot::signal<int> sig;
+        sig.enable_disconnect_index();
+        auto l1 = [&](int i) { sum += i; };
+
+        sig.connect(o1{});
+        sig.connect(o2{});
+        sig.connect(l1);
+        sig.connect(l1);
+        assert(sig.disconnect(o1{}) == 1);
+        assert(sig.disconnect(l1) == 2);
+        sig(1);
+        assert(sum == 1);
+    }
+#endif
+}
+
+void test_disconnection_many() {
+    // enough slots for the packed keys to be compared several at a time
+    for (bool indexed : {false, true}) {
+        sum = 0;
+        sigslot::signal<int> sig;
+        if (indexed) {
+            sig.enable_disconnect_index();
+        }
+        s p[3];
+
+        for (int i = 0; i < 37; ++i) {
+            sig.connect(&s::f1, &p[i % 3], i % 4);
+            sig.connect(i % 2 ? f1 : f2, i % 5);
+        }
+        assert(sig.slot_count() == 74);
+
+        assert(sig.disconnect(&p[1]) == 12);
+        assert(sig.disconnect(&s::f1, &p[0]) == 13);
+        assert(sig.disconnect(f2) == 19);
+        assert(sig.disconnect(&p[1]) == 0);
+        assert(sig.slot_count() == 30);
+
+        sig(1);
+        assert(sum == 30);
+    }
+}
+
 int main() {
     test_free_connection();
     test_static_connection();
@@ -687,6 +835,8 @@ int main() {
     test_disconnection_by_callable();
     test_disconnection_by_object();
     test_disconnection_by_object_and_pmf();
+    test_disconnection_indexed();
+    test_disconnection_many();
     test_scoped_connection();
     test_connection_blocker();
     test_connection_blocking();
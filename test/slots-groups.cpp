@@ -1,9 +1,12 @@
 #include "test-common.h"
 #include <sigslot/signal.hpp>
 #include <algorithm>
+#include <atomic>
 #include <array>
 #include <cassert>
 #include <random>
+#include <thread>
+#include <vector>
 
 using res_container = std::vector<int32_t>;
 
@@ -82,9 +85,186 @@ static void test_block_group() {
     assert(sum == 15);
 }
 
+static void test_block_group_state() {
+    int sum = 0;
+    sigslot::signal<int&> sig;
+    auto c = sig.connect(adder(1), 1);
+    sig.connect(adder(2), 2);
+
+    // group and slot blocking are independent from each other
+    sig.block(1);
+    assert(sig.blocked(1));
+    assert(!c.blocked());
+    c.block();
+    sig.unblock(1);
+    sig(sum);
+    assert(sum == 2);
+    c.unblock();
+
+    // unknown groups are ignored
+    sig.block(42);
+    assert(!sig.blocked(42));
+
+    // slots connected to a blocked group are blocked as well
+    sig.block(2);
+    sig.connect(adder(10), 2);
+    sig(sum);
+    assert(sum == 3);
+
+    // an emptied group keeps its blocking state
+    assert(sig.disconnect(2) == 2);
+    sig.connect(adder(100), 2);
+    sig(sum);
+    assert(sum == 4);
+    assert(sig.slot_count() == 2);
+}
+
+static void test_group_handle() {
+    int sum = 0;
+    sigslot::signal<int&> sig;
+    assert(!sigslot::group_handle{}.valid());
+
+    // the handle may be obtained ahead of the connections
+    auto debug = sig.group(5);
+    assert(debug.valid());
+    debug.block();
+    sig.connect(adder(1), 0);
+    sig.connect(adder(10), 5);
+    sig.connect(adder(100), 5);
+    assert(sig.has_listeners());
+    sig(sum);
+    assert(sum == 1);
+
+    debug.unblock();
+    sig(sum);
+    assert(sum == 112);
+
+    // a blocked group does not count as a listener
+    sig.disconnect(0);
+    debug.block();
+    assert(!sig.has_listeners());
+    sig.connect(adder(1000), 5);
+    assert(!sig.has_listeners());
+    debug.unblock();
+    assert(sig.has_listeners());
+    assert(sig.blocked(5) == debug.blocked());
+
+    // the handle survives the signal
+    {
+        sigslot::signal<int&> other;
+        debug = other.group(1);
+        other.connect(adder(1), 1);
+    }
+    debug.block();
+    assert(debug.blocked());
+}
+
+static void test_group_handle_moved_signal() {
+    sigslot::signal<int&> sig;
+    sig.connect(adder(1), 1);
+    auto h = sig.group(1);
+
+    sigslot::signal<int&> moved{std::move(sig)};
+    h.block();
+    assert(!moved.has_listeners());
+    h.unblock();
+    assert(moved.has_listeners());
+    assert(!sig.has_listeners());
+}
+
+static void test_group_handle_threaded() {
+    std::atomic<int> sum{0};
+    sigslot::signal<int> sig;
+    sig.connect([&](int i) { sum += i; }, 0);
+    sig.connect([&](int i) { sum += i; }, 1);
+    auto h = sig.group(1);
+
+    std::thread toggler([&] {
+        for (int i = 0; i < 10000; ++i) {
+            h.block();
+            h.unblock();
+        }
+    });
+
+    for (int i = 0; i < 10000; ++i) {
+        sig(1);
+    }
+    toggler.join();
+
+    assert(sum >= 10000 && sum <= 20000);
+    assert(sig.has_listeners());
+    h.block();
+    sig.disconnect(0);
+    assert(!sig.has_listeners());
+}
+
+static void test_emit_group() {
+    sigslot::signal<res_container&> sig;
+    for (int g : {5, -3, 0, 7, 100, 2}) {
+        sig.connect(pusher(g), g);
+    }
+    sig.connect(pusher(70), 7);
+
+    res_container res;
+    sig.emit_group(7, res);
+    assert((res == res_container{7, 70}));
+
+    res.clear();
+    sig.emit_group(4, res);
+    sig.emit_group(1000, res);
+    assert(res.empty());
+
+    sig.emit_range(0, 100, res);
+    assert((res == res_container{0, 2, 5, 7, 70}));
+
+    res.clear();
+    sig.emit_range(-100, 1, res);
+    assert((res == res_container{-3, 0}));
+
+    res.clear();
+    sig.emit_range(3, 3, res);
+    sig.emit_range(100, 0, res);
+    assert(res.empty());
+
+    // blocking is honored
+    sig.block(5);
+    sig.emit_range(0, 6, res);
+    assert((res == res_container{0, 2}));
+
+    res.clear();
+    sig.block();
+    sig.emit_group(0, res);
+    assert(res.empty());
+}
+
+static void test_emit_group_interface() {
+    struct owner {
+        sigslot::signal_ix<owner, res_container&> sig;
+        void audit(res_container &r) { sig.emit_group(1, r); }
+        void low(res_container &r) { sig.emit_range(0, 2, r); }
+    };
+
+    owner o;
+    o.sig.connect(pusher(1), 1);
+    o.sig.connect(pusher(2), 2);
+    o.sig.connect(pusher(0), 0);
+
+    res_container res;
+    o.audit(res);
+    assert((res == res_container{1}));
+    o.low(res);
+    assert((res == res_container{1, 0, 1}));
+}
+
 int main() {
     test_random_groups();
     test_disconnect_group();
     test_block_group();
+    test_block_group_state();
+    test_group_handle();
+    test_group_handle_moved_signal();
+    test_group_handle_threaded();
+    test_emit_group();
+    test_emit_group_interface();
     return 0;
 }
@@ -0,0 +1,157 @@
+#include "test-common.h"
+#include <sigslot/topic_bus.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+
+using res_container = std::vector<std::string>;
+
+static auto recorder(res_container &res, std::string name) {
+    return [&res, name=std::move(name)](int) { res.push_back(name); };
+}
+
+static res_container emit(sigslot::topic_bus<int> &bus, res_container &res, std::string_view topic) {
+    res.clear();
+    bus.emit(topic, 0);
+    std::sort(res.begin(), res.end());
+    return res;
+}
+
+void test_matching() {
+    sigslot::topic_bus<int> bus;
+    res_container res;
+
+    bus.connect("orders.eu.filled", recorder(res, "exact"));
+    bus.connect("orders.*.filled", recorder(res, "star"));
+    bus.connect("orders.#", recorder(res, "hash"));
+    bus.connect("#.filled", recorder(res, "suffix"));
+    bus.connect("*", recorder(res, "one"));
+    assert(bus.pattern_count() == 5);
+
+    assert((emit(bus, res, "orders.eu.filled") == res_container{"exact", "hash", "star", "suffix"}));
+    assert((emit(bus, res, "orders.us.filled") == res_container{"hash", "star", "suffix"}));
+    assert((emit(bus, res, "orders.eu.cancelled") == res_container{"hash"}));
+    assert((emit(bus, res, "orders.eu.filled.partially") == res_container{"hash"}));
+
+    // "#" matches no segment as well
+    assert((emit(bus, res, "orders") == res_container{"hash", "one"}));
+    assert((emit(bus, res, "filled") == res_container{"one", "suffix"}));
+    assert((emit(bus, res, "quotes.eu") == res_container{}));
+}
+
+void test_single_call() {
+    sigslot::topic_bus<int> bus;
+    int count = 0;
+
+    // matches "a.b" in several ways, the slot is still called once
+    bus.connect("#.#", [&](int) { ++count; });
+    bus.connect("a.#.#", [&](int) { ++count; });
+
+    bus.emit("a.b", 0);
+    assert(count == 2);
+}
+
+void test_cache() {
+    sigslot::topic_bus<int> bus(2);
+    res_container res;
+
+    bus.connect("a.*", recorder(res, "star"));
+    assert(bus.cache_size() == 0);
+
+    assert((emit(bus, res, "a.b") == res_container{"star"}));
+    assert((emit(bus, res, "a.b") == res_container{"star"}));
+    assert(bus.cache_size() == 1);
+
+    // connecting to a known pattern keeps the cache
+    bus.connect("a.*", recorder(res, "star2"));
+    assert(bus.cache_size() == 1);
+    assert((emit(bus, res, "a.b") == res_container{"star", "star2"}));
+
+    // a new pattern empties it
+    bus.connect("a.b", recorder(res, "exact"));
+    assert(bus.cache_size() == 0);
+    assert((emit(bus, res, "a.b") == res_container{"exact", "star", "star2"}));
+
+    // the cache is bounded
+    emit(bus, res, "a.c");
+    assert(bus.cache_size() == 2);
+    emit(bus, res, "a.d");
+    assert(bus.cache_size() == 1);
+}
+
+void test_disconnect() {
+    sigslot::topic_bus<int> bus;
+    res_container res;
+
+    auto c = bus.connect("a.*", recorder(res, "star"));
+    bus.connect("a.*", recorder(res, "star2"));
+    bus.connect("a.b.c", recorder(res, "deep"));
+    bus.connect("#", recorder(res, "all"));
+
+    c.disconnect();
+    assert((emit(bus, res, "a.b") == res_container{"all", "star2"}));
+
+    assert(bus.disconnect("a.*") == 1);
+    assert(bus.disconnect("a.*") == 0);
+    assert(bus.disconnect("a.b") == 0);
+    assert(bus.pattern_count() == 2);
+    assert((emit(bus, res, "a.b") == res_container{"all"}));
+
+    assert(bus.disconnect("#") == 1);
+    assert((emit(bus, res, "a.b.c") == res_container{"deep"}));
+
+    bus.disconnect_all();
+    assert(bus.pattern_count() == 0);
+    assert((emit(bus, res, "a.b.c") == res_container{}));
+}
+
+void test_extended() {
+    sigslot::topic_bus_st<int> bus;
+    int sum = 0;
+
+    bus.connect_extended("a.#", [&](sigslot::connection &c, int i) {
+        sum += i;
+        c.disconnect();
+    });
+    bus.emit("a", 1);
+    bus.emit("a", 1);
+    assert(sum == 1);
+}
+
+void test_threaded() {
+    sigslot::topic_bus<int> bus(16);
+    std::atomic<int> sum{0};
+    bus.connect("t.#", [&](int i) { sum += i; });
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t] {
+            const std::string own = "own." + std::to_string(t);
+            for (int i = 0; i < 1000; ++i) {
+                bus.emit("t." + std::to_string(i % 50), 1);
+                // churn on patterns, emptying the cache
+                bus.connect(own, [](int) {});
+                bus.disconnect(own);
+            }
+        });
+    }
+
+    for (auto &t : threads) {
+        t.join();
+    }
+    assert(sum == 4000);
+    assert(bus.pattern_count() == 1);
+}
+
+int main() {
+    test_matching();
+    test_single_call();
+    test_cache();
+    test_disconnect();
+    test_extended();
+    test_threaded();
+    return 0;
+}
@@ -0,0 +1,139 @@
+#include "test-common.h"
+#include <sigslot/signal.hpp>
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <thread>
+#include <vector>
+
+struct t : sigslot::trackable {
+    ~t() override {
+        this->expire();
+        value = 0;
+    }
+
+    void f1(int &i) { i += value; }
+    void f2(int &i) const { i += value; }
+
+    int value = 1;
+};
+
+struct self_destroying : sigslot::trackable {
+    std::unique_ptr<self_destroying> *owner = nullptr;
+    void f(int &i) {
+        ++i;
+        owner->reset();
+    }
+};
+
+void test_trackable() {
+    sigslot::signal<int &> sig;
+    int sum = 0;
+
+    {
+        t p1;
+        const t p2;
+        sig.connect(&t::f1, &p1);
+        sig.connect(&t::f2, &p2);
+        sig.connect([](int &i) { i += 10; }, &p1);
+        assert(sig.slot_count() == 3);
+
+        sig(sum);
+        assert(sum == 12);
+    }
+
+    // the dead slots are skipped, then disconnected by the emission
+    assert(sig.slot_count() == 3);
+    sig(sum);
+    assert(sum == 12);
+    assert(sig.slot_count() == 0);
+}
+
+void test_connection() {
+    sigslot::signal<int &> sig;
+    int sum = 0;
+
+    auto p = std::make_unique<t>();
+    auto c = sig.connect(&t::f1, p.get());
+    assert(c.connected());
+
+    p.reset();
+    assert(!c.connected());
+    sig(sum);
+    assert(sum == 0);
+}
+
+void test_disconnect_object() {
+    sigslot::signal<int &> sig;
+    int sum = 0;
+    t p1, p2;
+
+    sig.connect(&t::f1, &p1);
+    sig.connect(&t::f1, &p2);
+    sig.connect([](int &i) { i += 10; }, &p1);
+
+    assert(sig.disconnect(&p1) == 2);
+    sig(sum);
+    assert(sum == 1);
+}
+
+void test_self_destruction() {
+    sigslot::signal<int &> sig;
+    int sum = 0;
+
+    // destroying an object from its own slot must not wait for itself
+    auto p = std::make_unique<self_destroying>();
+    p->owner = &p;
+    sig.connect(&self_destroying::f, p.get());
+
+    sig(sum);
+    assert(!p);
+    sig(sum);
+    assert(sum == 1);
+    assert(sig.slot_count() == 0);
+}
+
+void test_threaded() {
+    sigslot::signal<int &> sig;
+    std::atomic<bool> run{true};
+    std::atomic<long> calls{0};
+
+    std::vector<std::thread> emitters;
+    for (int i = 0; i < 4; ++i) {
+        emitters.emplace_back([&] {
+            while (run) {
+                int sum = 0;
+                sig(sum);
+                calls += sum;
+            }
+        });
+    }
+
+    // objects are destroyed while their slots get called: a slot running on
+    // a destroyed object would see its value reset
+    for (int i = 0; i < 2000; ++i) {
+        auto p = std::make_unique<t>();
+        sig.connect(&t::f1, p.get());
+        sig.connect([q = p.get()](int &s) { assert(q->value == 1); s += q->value; }, p.get());
+        std::this_thread::yield();
+    }
+
+    run = false;
+    for (auto &e : emitters) {
+        e.join();
+    }
+
+    int sum = 0;
+    sig(sum);
+    assert(sum == 0);
+    assert(sig.slot_count() == 0);
+}
+
+int main() {
+    test_trackable();
+    test_connection();
+    test_disconnect_object();
+    test_self_destruction();
+    test_threaded();
+    return 0;
+}